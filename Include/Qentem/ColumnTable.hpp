@@ -0,0 +1,574 @@
+/**
+ * @file ColumnTable.hpp
+ * @brief Column-wise form of an array of records, for work that reads one field of every row.
+ *
+ * An array of objects keeps each row as a table of its own, keys and values interleaved, so
+ * a pass over one field, such as sorting or grouping by it, touches at least a cache line
+ * per row. ColumnTable stores the same records by column: one array per key, holding that
+ * key's value for every row. A column whose values all have one type keeps them unboxed:
+ * numbers as contiguous 64-bit integers or doubles, booleans as 0 and 1, and strings as
+ * views into one block of text shared by the table. Any other column, including one that
+ * some rows lack, keeps a Value per row.
+ *
+ * Rows are read back as Values, one at a time (GetValueAt(), GetValue()) or all at once
+ * (ToValue()). SortBy() reorders the rows by one column, stably, comparing the column's raw
+ * keys. GroupBy() gives what Value::GroupBy() gives for the same records.
+ *
+ * The table is built once from the records; apart from sorting, it is not edited.
+ *
+ * @copyright Copyright (c) 2026 Hani Ammar
+ * @license MIT
+ */
+
+#ifndef QENTEM_COLUMN_TABLE_H
+#define QENTEM_COLUMN_TABLE_H
+
+#include "Qentem/Value.hpp"
+
+namespace Qentem {
+
+enum struct ColumnType : SizeT8 { Mixed, Natural, Integer, Real, Bool, String };
+
+template <typename Char_T>
+struct ColumnTable {
+    using ValueT      = Value<Char_T>;
+    using ObjectT     = typename ValueT::ObjectT;
+    using ArrayT      = typename ValueT::ArrayT;
+    using VItem       = typename ValueT::VItem;
+    using StringT     = String<Char_T>;
+    using StringViewT = StringView<Char_T>;
+
+    struct Column {
+        StringT            Key;
+        SizeT              Hash{0}; // Of Key, for the objects that rows are read back into.
+        ColumnType         Type{ColumnType::Mixed};
+        Array<QNumber64>   Numbers{}; // Natural, Integer, Real and Bool.
+        Array<StringViewT> Strings{}; // String: views into the table's text.
+        Array<ValueT>      Values{};  // Mixed: undefined where a row has no such member.
+    };
+
+    ColumnTable() noexcept = default;
+
+    /**
+     * @brief Builds the table from records, an array of objects.
+     *
+     * Columns follow the order in which keys first appear. Removed items are skipped; if any
+     * other item is not an object, the table is left empty.
+     */
+    explicit ColumnTable(const ValueT &records) {
+        build(records);
+    }
+
+    ColumnTable(ColumnTable &&src) noexcept
+        : columns_{QUtility::Move(src.columns_)}, index_{QUtility::Move(src.index_)}, text_{src.text_},
+          text_length_{src.text_length_}, rows_{src.rows_} {
+        src.text_        = nullptr;
+        src.text_length_ = 0;
+        src.rows_        = 0;
+    }
+
+    ColumnTable &operator=(ColumnTable &&src) noexcept {
+        if (this != &src) {
+            reset();
+
+            columns_     = QUtility::Move(src.columns_);
+            index_       = QUtility::Move(src.index_);
+            text_        = src.text_;
+            text_length_ = src.text_length_;
+            rows_        = src.rows_;
+
+            src.text_        = nullptr;
+            src.text_length_ = 0;
+            src.rows_        = 0;
+        }
+
+        return *this;
+    }
+
+    ColumnTable(const ColumnTable &)            = delete;
+    ColumnTable &operator=(const ColumnTable &) = delete;
+
+    ~ColumnTable() {
+        releaseText();
+    }
+
+    QENTEM_INLINE SizeT Rows() const noexcept {
+        return rows_;
+    }
+
+    QENTEM_INLINE SizeT Columns() const noexcept {
+        return columns_.Size();
+    }
+
+    QENTEM_INLINE const Column *GetColumnAt(SizeT index) const noexcept {
+        return ((index < columns_.Size()) ? (columns_.First() + index) : nullptr);
+    }
+
+    const Column *GetColumn(const Char_T *key, SizeT length) const noexcept {
+        const SizeT *index = index_.GetValue(key, length);
+        return ((index != nullptr) ? (columns_.First() + *index) : nullptr);
+    }
+
+    /**
+     * @brief The row at index as an object, members in column order.
+     */
+    ValueT GetValueAt(SizeT row) const {
+        if (row < rows_) {
+            return rowObject(row, columns_.Size());
+        }
+
+        return ValueT{};
+    }
+
+    /**
+     * @brief The value of key in row, undefined if the row has none.
+     */
+    ValueT GetValue(SizeT row, const Char_T *key, SizeT length) const {
+        const Column *column = GetColumn(key, length);
+
+        if ((column != nullptr) && (row < rows_)) {
+            return cell(*column, row);
+        }
+
+        return ValueT{};
+    }
+
+    // The records again, as an array of objects.
+    ValueT ToValue() const {
+        ValueT records{ValueType::Array, rows_};
+
+        for (SizeT row = 0; row < rows_; row++) {
+            records += rowObject(row, columns_.Size());
+        }
+
+        return records;
+    }
+
+    /**
+     * @brief Reorders the rows by the column of key; rows with equal keys keep their order.
+     *
+     * Typed columns are sorted on their raw keys; numbers are radix sorted by value, strings
+     * compared as StringView does. Mixed ones compare Values, as Value::Sort() does.
+     *
+     * @return false if there is no such column.
+     */
+    bool SortBy(const Char_T *key, SizeT length, bool ascend = true) {
+        const SizeT *index = index_.GetValue(key, length);
+
+        if (index == nullptr) {
+            return false;
+        }
+
+        if (rows_ > SizeT{1}) {
+            Array<SizeT>  order{rows_};
+            const Column &column = columns_.First()[*index];
+
+            switch (column.Type) {
+                case ColumnType::Natural:
+                case ColumnType::Bool: {
+                    sortRows<SizeT64>(column, order, ascend, QNumberType::Natural);
+                    break;
+                }
+
+                case ColumnType::Integer: {
+                    sortRows<SizeT64>(column, order, ascend, QNumberType::Integer);
+                    break;
+                }
+
+                case ColumnType::Real: {
+                    sortRows<SizeT64>(column, order, ascend, QNumberType::Real);
+                    break;
+                }
+
+                case ColumnType::String: {
+                    sortRows<StringViewT>(column, order, ascend);
+                    break;
+                }
+
+                default: {
+                    sortRows<QUtility::SortRef<ValueT>>(column, order, ascend);
+                }
+            }
+
+            Column       *item = columns_.Storage();
+            const Column *end  = (item + columns_.Size());
+
+            while (item != end) {
+                switch (item->Type) {
+                    case ColumnType::String: {
+                        permute(item->Strings, order);
+                        break;
+                    }
+
+                    case ColumnType::Mixed: {
+                        permute(item->Values, order);
+                        break;
+                    }
+
+                    default: {
+                        permute(item->Numbers, order);
+                    }
+                }
+
+                ++item;
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Groups the rows by the value of key, as Value::GroupBy() does.
+     *
+     * @return false if there is no such column, or a row has no value for it.
+     */
+    bool GroupBy(ValueT &grouped, const Char_T *key, SizeT length) const {
+        const SizeT *index = index_.GetValue(key, length);
+
+        if (index == nullptr) {
+            return false;
+        }
+
+        const Column        &column = columns_.First()[*index];
+        StringStream<Char_T> stream;
+
+        grouped = ValueT{ValueType::Object};
+
+        for (SizeT row = 0; row < rows_; row++) {
+            const Char_T *str;
+            SizeT         str_len;
+            const ValueT  name = cell(column, row);
+
+            if (!(name.SetCharAndLength(str, str_len))) {
+                stream.Clear();
+
+                if (name.IsUndefined() || !(name.CopyValueTo(stream))) {
+                    return false;
+                }
+
+                str     = stream.First();
+                str_len = stream.Length();
+            }
+
+            ValueT &group = grouped.Get(str, str_len);
+
+            if (!(group.IsArray())) {
+                group = ValueT{ValueType::Array};
+            }
+
+            group += rowObject(row, *index);
+        }
+
+        return true;
+    }
+
+  private:
+    // The sort key of a row: a number's SortKey(type), a string's view, or a pointer to the
+    // row's Value in a Mixed column.
+    template <typename Key_T>
+    QENTEM_INLINE static Key_T sortKey(const Column &column, SizeT row, QNumberType type) noexcept {
+        if constexpr (QTraits::IsSame<Key_T, SizeT64>::Value) {
+            return column.Numbers.First()[row].SortKey(type);
+        } else if constexpr (QTraits::IsSame<Key_T, StringViewT>::Value) {
+            return column.Strings.First()[row];
+        } else {
+            return Key_T{column.Values.First() + row};
+        }
+    }
+
+    // Fills order with the rows sorted by one column, through (key, row) pairs, so the keys are
+    // read from one contiguous array and equal keys stay in order.
+    template <typename Key_T>
+    void sortRows(const Column &column, Array<SizeT> &order, bool ascend,
+                  QNumberType type = QNumberType::NotANumber) const {
+        using EntryT = QUtility::SortEntry<Key_T, SizeT>;
+
+        Array<EntryT> entries{rows_, true};
+        Array<EntryT> buffer{rows_, true};
+        EntryT       *from = entries.Storage();
+
+        for (SizeT row = 0; row < rows_; row++) {
+            from[row].Key   = sortKey<Key_T>(column, row, type);
+            from[row].Index = row;
+        }
+
+        const EntryT *sorted = QUtility::SortEntries(from, buffer.Storage(), rows_, ascend);
+
+        for (SizeT row = 0; row < rows_; row++) {
+            order += sorted[row].Index;
+        }
+    }
+
+    template <typename Type_T>
+    static void permute(Array<Type_T> &items, const Array<SizeT> &order) {
+        Array<Type_T> sorted{order.Size()};
+        const SizeT  *row = order.First();
+        const SizeT  *end = order.End();
+        Type_T       *src = items.Storage();
+
+        while (row != end) {
+            sorted += QUtility::Move(src[*row]);
+            ++row;
+        }
+
+        items = QUtility::Move(sorted);
+    }
+
+    static ValueT cell(const Column &column, SizeT row) {
+        switch (column.Type) {
+            case ColumnType::Natural: {
+                return ValueT{column.Numbers.First()[row].Natural};
+            }
+
+            case ColumnType::Integer: {
+                return ValueT{column.Numbers.First()[row].Integer};
+            }
+
+            case ColumnType::Real: {
+                return ValueT{column.Numbers.First()[row].Real};
+            }
+
+            case ColumnType::Bool: {
+                return ValueT{column.Numbers.First()[row].Natural != 0};
+            }
+
+            case ColumnType::String: {
+                return ValueT{column.Strings.First()[row]};
+            }
+
+            default: {
+                return column.Values.First()[row];
+            }
+        }
+    }
+
+    // The row as an object, leaving out the column at skip (columns_.Size() for none).
+    ValueT rowObject(SizeT row, SizeT skip) const {
+        ObjectT       object{columns_.Size()};
+        const Column *column = columns_.First();
+
+        for (SizeT index = 0; index < columns_.Size(); index++) {
+            if (index != skip) {
+                ValueT value = cell(column[index], row);
+
+                if (!(value.IsUndefined())) {
+                    object.Get(StringT{column[index].Key}, column[index].Hash) = QUtility::Move(value);
+                }
+            }
+        }
+
+        return ValueT{QUtility::Move(object)};
+    }
+
+    static ColumnType typeOf(const ValueT &value) noexcept {
+        if (value.IsString()) {
+            return ColumnType::String;
+        }
+
+        if (value.IsUInt64()) {
+            return ColumnType::Natural;
+        }
+
+        if (value.IsInt64()) {
+            return ColumnType::Integer;
+        }
+
+        if (value.IsDouble()) {
+            return ColumnType::Real;
+        }
+
+        if (value.IsTrue() || value.IsFalse()) {
+            return ColumnType::Bool;
+        }
+
+        return ColumnType::Mixed;
+    }
+
+    void build(const ValueT &records) {
+        const ArrayT *items = records.GetArray();
+
+        if (items == nullptr) {
+            return;
+        }
+
+        const ValueT *item = items->First();
+        const ValueT *end  = items->End();
+        Array<SizeT>  present{};
+
+        // First pass: the columns, their types and the room their strings need.
+        while (item != end) {
+            if (!(item->IsUndefined())) {
+                const ObjectT *object = item->GetObject();
+
+                if (object == nullptr) {
+                    reset();
+                    return;
+                }
+
+                const VItem *member     = object->First();
+                const VItem *member_end = (member + object->Size());
+
+                while (member != member_end) {
+                    if (!(member->Value.IsUndefined())) {
+                        const SizeT      index = columnIndex(member->Key, present);
+                        Column          &column = columns_.Storage()[index];
+                        const ColumnType type   = typeOf(member->Value);
+
+                        if (present.Storage()[index] == 0) {
+                            column.Type = type;
+                        } else if (column.Type != type) {
+                            column.Type = ColumnType::Mixed;
+                        }
+
+                        if (type == ColumnType::String) {
+                            text_length_ += member->Value.GetStringView().Length();
+                        }
+
+                        ++(present.Storage()[index]);
+                    }
+
+                    ++member;
+                }
+
+                ++rows_;
+            }
+
+            ++item;
+        }
+
+        if (text_length_ != 0) {
+            text_ = Reserver::Reserve<Char_T>(text_length_);
+        }
+
+        Column *column = columns_.Storage();
+
+        for (SizeT index = 0; index < columns_.Size(); index++) {
+            if (present.First()[index] != rows_) {
+                column[index].Type = ColumnType::Mixed;
+            }
+
+            switch (column[index].Type) {
+                case ColumnType::String: {
+                    column[index].Strings.Reserve(rows_);
+                    break;
+                }
+
+                case ColumnType::Mixed: {
+                    column[index].Values.ResizeWithDefaultInit(rows_);
+                    break;
+                }
+
+                default: {
+                    column[index].Numbers.Reserve(rows_);
+                }
+            }
+        }
+
+        // Second pass: the values. Every row adds one to each typed column, in row order.
+        Char_T *text = text_;
+        SizeT   row{0};
+        item = items->First();
+
+        while (item != end) {
+            if (!(item->IsUndefined())) {
+                const ObjectT *object     = item->GetObject();
+                const VItem   *member     = object->First();
+                const VItem   *member_end = (member + object->Size());
+
+                while (member != member_end) {
+                    const ValueT &value = member->Value;
+
+                    if (!(value.IsUndefined())) {
+                        Column &target = column[*(index_.GetValue(member->Key.First(), member->Key.Length()))];
+
+                        switch (target.Type) {
+                            case ColumnType::Natural: {
+                                target.Numbers += QNumber64{value.GetUInt64()};
+                                break;
+                            }
+
+                            case ColumnType::Integer: {
+                                target.Numbers += QNumber64{value.GetInt64()};
+                                break;
+                            }
+
+                            case ColumnType::Real: {
+                                target.Numbers += QNumber64{value.GetDouble()};
+                                break;
+                            }
+
+                            case ColumnType::Bool: {
+                                target.Numbers += QNumber64{SizeT64{value.IsTrue()}};
+                                break;
+                            }
+
+                            case ColumnType::String: {
+                                const StringViewT string = value.GetStringView();
+
+                                MemoryUtils::CopyTo(text, string.First(), string.Length());
+                                target.Strings += StringViewT{text, string.Length()};
+                                text += string.Length();
+                                break;
+                            }
+
+                            default: {
+                                target.Values.Storage()[row] = value;
+                            }
+                        }
+                    }
+
+                    ++member;
+                }
+
+                ++row;
+            }
+
+            ++item;
+        }
+    }
+
+    SizeT columnIndex(const StringT &key, Array<SizeT> &present) {
+        const SizeT *index = index_.GetValue(key.First(), key.Length());
+
+        if (index != nullptr) {
+            return *index;
+        }
+
+        const SizeT new_index = columns_.Size();
+        Column      column;
+
+        column.Key  = key;
+        column.Hash = StringUtils::Hash<Char_T, SizeT>(key.First(), key.Length());
+        columns_ += QUtility::Move(column);
+        present += SizeT{0};
+        index_.Insert(key, new_index);
+
+        return new_index;
+    }
+
+    void releaseText() noexcept {
+        if (text_ != nullptr) {
+            Reserver::Release(text_, text_length_);
+            text_ = nullptr;
+        }
+
+        text_length_ = 0;
+    }
+
+    void reset() noexcept {
+        columns_.Reset();
+        index_.Reset();
+        releaseText();
+        rows_ = 0;
+    }
+
+    Array<Column>          columns_{};
+    HArray<StringT, SizeT> index_{};
+    Char_T                *text_{nullptr};
+    SizeT                  text_length_{0};
+    SizeT                  rows_{0};
+};
+
+} // namespace Qentem
+
+#endif
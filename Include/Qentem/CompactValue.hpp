@@ -0,0 +1,753 @@
+/**
+ * @file CompactValue.hpp
+ * @brief Read-only, 16-byte-per-node form of a Value tree for long-lived data.
+ *
+ * Built by Value::Freeze() or the CompactTree constructor.
+ *
+ * A Value node takes 24 bytes (a 16-byte union and a type byte), and its containers carry
+ * capacity slack and, for objects, a hash table. CompactTree copies a Value tree into a
+ * single reservation of CompactValue nodes, each 16 bytes: an 8-byte payload, the size,
+ * and the type. The children of a container are laid out next to each other, so only the
+ * container needs a pointer to them, and sizes are exact.
+ *
+ * Objects store their members as key/value node pairs in their original order. Small ones
+ * are searched linearly; from HashedMinimum members on, an open-addressing table of
+ * (hash, index) slots at no more than half load follows the pairs, so a key is usually
+ * found on the first probe. The hash is StringUtils::Hash(), the one Template computes for
+ * its variables when parsing, so a template lookup costs no hashing at render time.
+ * Strings of up to InlineCapacity characters live inside their node. Longer strings are
+ * copied to the end of the same reservation, null-terminated.
+ *
+ * The tree cannot be modified, so it can be read from several threads at once; ToValue()
+ * gives back a Value for editing. Undefined items take no node; the tree holds only the rest.
+ *
+ * Template renders a CompactValue as it does a Value, except for loops that group or sort,
+ * which need a Value: such a group renders nothing and sorting leaves the order as is.
+ *
+ * @copyright Copyright (c) 2026 Hani Ammar
+ * @license MIT
+ */
+
+#ifndef QENTEM_COMPACT_VALUE_H
+#define QENTEM_COMPACT_VALUE_H
+
+#include "Qentem/Value.hpp"
+
+namespace Qentem {
+
+template <typename Char_T>
+struct CompactTree;
+
+template <typename Char_T>
+struct CompactValue {
+    using NotationConstants = JSONUtils::NotationConstants_T<Char_T>;
+    using StringViewT       = StringView<Char_T>;
+
+    static constexpr SizeT InlineCapacity{SizeT(sizeof(QNumber64) / sizeof(Char_T)) - SizeT{1}};
+    static constexpr SizeT HashedMinimum{8};
+
+    CompactValue() noexcept : items_{nullptr} {
+    }
+
+    QENTEM_INLINE ValueType Type() const noexcept {
+        return type_;
+    }
+
+    QENTEM_INLINE bool IsUndefined() const noexcept {
+        return (type_ == ValueType::Undefined);
+    }
+
+    QENTEM_INLINE bool IsObject() const noexcept {
+        return (type_ == ValueType::Object);
+    }
+
+    QENTEM_INLINE bool IsArray() const noexcept {
+        return (type_ == ValueType::Array);
+    }
+
+    QENTEM_INLINE bool IsString() const noexcept {
+        return (type_ == ValueType::String);
+    }
+
+    QENTEM_INLINE bool IsUInt64() const noexcept {
+        return (type_ == ValueType::UIntLong);
+    }
+
+    QENTEM_INLINE bool IsInt64() const noexcept {
+        return (type_ == ValueType::IntLong);
+    }
+
+    QENTEM_INLINE bool IsDouble() const noexcept {
+        return (type_ == ValueType::Double);
+    }
+
+    QENTEM_INLINE bool IsNumber() const noexcept {
+        return (IsUInt64() || IsInt64() || IsDouble());
+    }
+
+    QENTEM_INLINE bool IsTrue() const noexcept {
+        return (type_ == ValueType::True);
+    }
+
+    QENTEM_INLINE bool IsFalse() const noexcept {
+        return (type_ == ValueType::False);
+    }
+
+    QENTEM_INLINE bool IsBool() const noexcept {
+        return (IsTrue() || IsFalse());
+    }
+
+    QENTEM_INLINE bool IsNull() const noexcept {
+        return (type_ == ValueType::Null);
+    }
+
+    // Number of items in an array or members in an object.
+    QENTEM_INLINE SizeT Size() const noexcept {
+        return (IsObject() || IsArray()) ? size_ : SizeT{0};
+    }
+
+    // Length of a string.
+    QENTEM_INLINE SizeT Length() const noexcept {
+        return IsString() ? size_ : SizeT{0};
+    }
+
+    const Char_T *StringStorage() const noexcept {
+        if (IsString()) {
+            return (size_ <= InlineCapacity) ? &(inline_[0]) : text_;
+        }
+
+        return nullptr;
+    }
+
+    QENTEM_INLINE StringViewT GetStringView() const noexcept {
+        return StringViewT{StringStorage(), Length()};
+    }
+
+    const CompactValue *GetValueAt(SizeT index) const noexcept {
+        if (index < Size()) {
+            return IsObject() ? (items_ + (index * SizeT{2}) + SizeT{1}) : (items_ + index);
+        }
+
+        return nullptr;
+    }
+
+    // The key of an object member, as a string node.
+    const CompactValue *GetKeyAt(SizeT index) const noexcept {
+        if (IsObject() && (index < size_)) {
+            return (items_ + (index * SizeT{2}));
+        }
+
+        return nullptr;
+    }
+
+    void SetValueAndKeyAt(SizeT index, const CompactValue *&value, StringViewT &key) const noexcept {
+        const CompactValue *key_node = GetKeyAt(index);
+
+        value = nullptr;
+
+        if (key_node != nullptr) {
+            value = (key_node + SizeT{1});
+            key   = key_node->GetStringView();
+        }
+    }
+
+    /**
+     * @brief Finds an object member by key, or an array item by its index written as text.
+     *
+     * @param hash StringUtils::Hash() of the key; only used by objects with a hash table.
+     * @return Pointer to the value, or nullptr if not found.
+     */
+    const CompactValue *GetValue(const Char_T *str, SizeT length, SizeT hash) const noexcept {
+        if (IsObject() && (size_ >= HashedMinimum)) {
+            const Slot *slots = reinterpret_cast<const Slot *>(items_ + (size_ * SizeT{2}));
+            const SizeT mask  = (tableCapacity(size_) - SizeT{1});
+            SizeT       index = (hash & mask);
+
+            while (slots[index].Hash != 0) {
+                if (slots[index].Hash == hash) {
+                    const CompactValue *key = (items_ + (slots[index].Index * SizeT{2}));
+
+                    if ((key->size_ == length) && StringUtils::IsEqual(key->StringStorage(), str, length)) {
+                        return (key + SizeT{1});
+                    }
+                }
+
+                index = ((index + SizeT{1}) & mask);
+            }
+
+            return nullptr;
+        }
+
+        return GetValue(str, length);
+    }
+
+    const CompactValue *GetValue(const Char_T *str, SizeT length) const noexcept {
+        if (IsObject()) {
+            if (size_ >= HashedMinimum) {
+                return GetValue(str, length, StringUtils::Hash(str, length));
+            }
+
+            const CompactValue *item = items_;
+            const CompactValue *end  = (items_ + (size_ * SizeT{2}));
+
+            while (item != end) {
+                if ((item->size_ == length) && StringUtils::IsEqual(item->StringStorage(), str, length)) {
+                    return (item + SizeT{1});
+                }
+
+                item += SizeT{2};
+            }
+        } else if (IsArray()) {
+            SizeT index;
+            Digit::FastStringToNumber(index, str, length);
+
+            return GetValueAt(index);
+        }
+
+        return nullptr;
+    }
+
+    QENTEM_INLINE const CompactValue *GetValue(const StringViewT &key) const noexcept {
+        return GetValue(key.First(), key.Length());
+    }
+
+    QENTEM_INLINE const CompactValue *GetValue(const StringViewT &key, SizeT hash) const noexcept {
+        return GetValue(key.First(), key.Length(), hash);
+    }
+
+    QNumberType GetNumberType() const noexcept {
+        switch (type_) {
+            case ValueType::UIntLong: {
+                return QNumberType::Natural;
+            }
+
+            case ValueType::IntLong: {
+                return QNumberType::Integer;
+            }
+
+            case ValueType::Double: {
+                return QNumberType::Real;
+            }
+
+            default: {
+                return QNumberType::NotANumber;
+            }
+        }
+    }
+
+    // Same conversions as Value::SetNumber().
+    QNumberType SetNumber(QNumber64 &number) const noexcept {
+        switch (type_) {
+            case ValueType::UIntLong:
+            case ValueType::IntLong:
+            case ValueType::Double: {
+                number = number_;
+                return GetNumberType();
+            }
+
+            case ValueType::True: {
+                number.Natural = SizeT64{1};
+                return QNumberType::Natural;
+            }
+
+            case ValueType::False:
+            case ValueType::Null: {
+                number.Natural = SizeT64{0};
+                return QNumberType::Natural;
+            }
+
+            case ValueType::String: {
+                SizeT             offset = 0;
+                const QNumberType n_type = Digit::StringToNumber(number, StringStorage(), offset, size_);
+
+                if (offset == size_) {
+                    return n_type;
+                }
+
+                break;
+            }
+
+            default: {
+            }
+        }
+
+        return QNumberType::NotANumber;
+    }
+
+    double GetDouble() const noexcept {
+        QNumber64 number;
+
+        switch (SetNumber(number)) {
+            case QNumberType::Natural: {
+                return double(number.Natural);
+            }
+
+            case QNumberType::Integer: {
+                return double(number.Integer);
+            }
+
+            case QNumberType::Real: {
+                return number.Real;
+            }
+
+            default: {
+                return 0.0;
+            }
+        };
+    }
+
+    // To get a pointer to a string value and its length, as Value::SetCharAndLength() does.
+    template <typename Number_T>
+    bool SetCharAndLength(const Char_T *&str, Number_T &length) const noexcept {
+        switch (type_) {
+            case ValueType::String: {
+                str    = StringStorage();
+                length = Number_T(size_);
+                return true;
+            }
+
+            case ValueType::True: {
+                str    = NotationConstants::TrueString;
+                length = NotationConstants::TrueStringLength;
+                return true;
+            }
+
+            case ValueType::False: {
+                str    = NotationConstants::FalseString;
+                length = NotationConstants::FalseStringLength;
+                return true;
+            }
+
+            case ValueType::Null: {
+                str    = NotationConstants::NullString;
+                length = NotationConstants::NullStringLength;
+                return true;
+            }
+
+            default: {
+                return false;
+            }
+        }
+    }
+
+    template <typename StringStream_T>
+    using CopyValueToStringFunction_T = void(StringStream_T &, const Char_T *, SizeT);
+
+    // Writes a scalar the way Value::CopyValueTo() does; false for containers and undefined.
+    template <typename StringStream_T, typename StringFunction_T = CopyValueToStringFunction_T<StringStream_T>>
+    bool CopyValueTo(StringStream_T              &stream,
+                     const Digit::RealFormatInfo &format_info = Digit::RealFormatInfo{QentemConfig::DoublePrecision},
+                     StringFunction_T            *string_function = nullptr) const {
+        switch (type_) {
+            case ValueType::String: {
+                if (string_function != nullptr) {
+                    string_function(stream, StringStorage(), size_);
+                } else {
+                    stream.Write(StringStorage(), size_);
+                }
+
+                break;
+            }
+
+            case ValueType::UIntLong: {
+                Digit::NumberToString(stream, number_.Natural);
+                break;
+            }
+
+            case ValueType::IntLong: {
+                Digit::NumberToString(stream, number_.Integer);
+                break;
+            }
+
+            case ValueType::Double: {
+                Digit::NumberToString(stream, number_.Real, format_info);
+                break;
+            }
+
+            case ValueType::True: {
+                stream.Write(NotationConstants::TrueString, NotationConstants::TrueStringLength);
+                break;
+            }
+
+            case ValueType::False: {
+                stream.Write(NotationConstants::FalseString, NotationConstants::FalseStringLength);
+                break;
+            }
+
+            case ValueType::Null: {
+                stream.Write(NotationConstants::NullString, NotationConstants::NullStringLength);
+                break;
+            }
+
+            default: {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    // Grouping builds new containers, which a frozen tree cannot hold; see ToValue().
+    QENTEM_INLINE bool GroupBy(CompactValue &, const Char_T *, SizeT) const noexcept {
+        return false;
+    }
+
+    // The tree is immutable; the order stays as it is. See ToValue().
+    QENTEM_INLINE void Sort(bool = true) const noexcept {
+    }
+
+    // A mutable copy of this node and everything under it.
+    Value<Char_T> ToValue() const {
+        switch (type_) {
+            case ValueType::Object: {
+                Value<Char_T>       value{ValueType::Object, size_};
+                const CompactValue *item = items_;
+                const CompactValue *end  = (items_ + (size_ * SizeT{2}));
+
+                while (item != end) {
+                    value.Insert(item->GetStringView(), (item + SizeT{1})->ToValue());
+                    item += SizeT{2};
+                }
+
+                return value;
+            }
+
+            case ValueType::Array: {
+                Value<Char_T>       value{ValueType::Array, size_};
+                const CompactValue *item = items_;
+                const CompactValue *end  = (items_ + size_);
+
+                while (item != end) {
+                    value += item->ToValue();
+                    ++item;
+                }
+
+                return value;
+            }
+
+            case ValueType::String: {
+                return Value<Char_T>{StringStorage(), size_};
+            }
+
+            case ValueType::UIntLong: {
+                return Value<Char_T>{number_.Natural};
+            }
+
+            case ValueType::IntLong: {
+                return Value<Char_T>{number_.Integer};
+            }
+
+            case ValueType::Double: {
+                return Value<Char_T>{number_.Real};
+            }
+
+            case ValueType::True: {
+                return Value<Char_T>{true};
+            }
+
+            case ValueType::False: {
+                return Value<Char_T>{false};
+            }
+
+            case ValueType::Null: {
+                return Value<Char_T>{nullptr};
+            }
+
+            default: {
+                return Value<Char_T>{};
+            }
+        }
+    }
+
+  private:
+    friend struct CompactTree<Char_T>;
+
+    struct Slot {
+        SizeT Hash;  // Never zero for a used slot; StringUtils::Hash() sets the highest bit.
+        SizeT Index; // Member index.
+    };
+
+    // The smallest power of two that keeps the table at most half full.
+    static SizeT tableCapacity(SizeT size) noexcept {
+        SizeT capacity{16};
+
+        while (capacity < (size * SizeT{2})) {
+            capacity <<= 1U;
+        }
+
+        return capacity;
+    }
+
+    // Nodes taken by the table of an object of this size.
+    static SizeT tableUnits(SizeT size) noexcept {
+        if (size >= HashedMinimum) {
+            return SizeT(((tableCapacity(size) * sizeof(Slot)) + (sizeof(CompactValue) - 1U)) / sizeof(CompactValue));
+        }
+
+        return 0;
+    }
+
+    union {
+        const CompactValue *items_; // Arrays: the items; objects: key and value pairs.
+        const Char_T       *text_;
+        QNumber64           number_;
+        Char_T              inline_[InlineCapacity + SizeT{1}];
+    };
+
+    SizeT     size_{0};
+    ValueType type_{ValueType::Undefined};
+};
+
+template <typename Char_T>
+struct CompactTree {
+    using ValueT = Value<Char_T>;
+    using NodeT  = CompactValue<Char_T>;
+
+    CompactTree() noexcept = default;
+
+    explicit CompactTree(const ValueT &value) {
+        SizeT nodes{0};
+        SizeT text{0};
+
+        count(value, nodes, text);
+
+        // Text goes after the nodes, in whole node-sized units.
+        units_ = (nodes + SizeT(((text * sizeof(Char_T)) + (sizeof(NodeT) - 1U)) / sizeof(NodeT)));
+
+        if (units_ != 0) {
+            storage_ = Reserver::Reserve<NodeT>(units_);
+        }
+
+        NodeT  *next_node = storage_;
+        Char_T *next_text = reinterpret_cast<Char_T *>(storage_ + nodes);
+
+        fill(root_, value, next_node, next_text);
+    }
+
+    CompactTree(CompactTree &&src) noexcept : root_{src.root_}, storage_{src.storage_}, units_{src.units_} {
+        src.root_    = NodeT{};
+        src.storage_ = nullptr;
+        src.units_   = 0;
+    }
+
+    CompactTree &operator=(CompactTree &&src) noexcept {
+        if (this != &src) {
+            release();
+
+            root_    = src.root_;
+            storage_ = src.storage_;
+            units_   = src.units_;
+
+            src.root_    = NodeT{};
+            src.storage_ = nullptr;
+            src.units_   = 0;
+        }
+
+        return *this;
+    }
+
+    CompactTree(const CompactTree &)            = delete;
+    CompactTree &operator=(const CompactTree &) = delete;
+
+    ~CompactTree() {
+        release();
+    }
+
+    QENTEM_INLINE const NodeT &Root() const noexcept {
+        return root_;
+    }
+
+    // Bytes held by the tree, the root node included.
+    QENTEM_INLINE SystemLong Bytes() const noexcept {
+        return SystemLong((SizeT{1} + units_) * sizeof(NodeT));
+    }
+
+    QENTEM_INLINE ValueT ToValue() const {
+        return root_.ToValue();
+    }
+
+  private:
+    QENTEM_INLINE static SizeT textLength(SizeT length) noexcept {
+        return (length > NodeT::InlineCapacity) ? (length + SizeT{1}) : SizeT{0};
+    }
+
+    static void count(const ValueT &value, SizeT &nodes, SizeT &text) noexcept {
+        switch (value.TargetType()) {
+            case ValueType::Object: {
+                const typename ValueT::ObjectT *obj    = value.GetObject();
+                const typename ValueT::VItem   *h_item = obj->First();
+                const typename ValueT::VItem   *end    = (h_item + obj->Size());
+
+                SizeT                           size{0};
+
+                while (h_item != end) {
+                    if ((h_item != nullptr) && !(h_item->Value.IsUndefined())) {
+                        ++size;
+                        text += textLength(h_item->Key.Length());
+                        count(h_item->Value, nodes, text);
+                    }
+
+                    ++h_item;
+                }
+
+                nodes += ((size * SizeT{2}) + NodeT::tableUnits(size));
+                break;
+            }
+
+            case ValueType::Array: {
+                for (const ValueT &item : *(value.GetArray())) {
+                    if (!(item.IsUndefined())) {
+                        ++nodes;
+                        count(item, nodes, text);
+                    }
+                }
+
+                break;
+            }
+
+            case ValueType::String: {
+                text += textLength(value.Length());
+                break;
+            }
+
+            default: {
+            }
+        }
+    }
+
+    static void setString(NodeT &node, const Char_T *str, SizeT length, Char_T *&next_text) noexcept {
+        Char_T *des = &(node.inline_[0]);
+
+        if (length > NodeT::InlineCapacity) {
+            des        = next_text;
+            node.text_ = des;
+            next_text += (length + SizeT{1});
+        }
+
+        MemoryUtils::CopyTo(des, str, length);
+        des[length] = Char_T{0};
+
+        node.size_ = length;
+        node.type_ = ValueType::String;
+    }
+
+    static void fill(NodeT &node, const ValueT &value, NodeT *&next_node, Char_T *&next_text) noexcept {
+        const ValueType type = value.TargetType();
+
+        node       = NodeT{};
+        node.type_ = type;
+
+        switch (type) {
+            case ValueType::Object: {
+                const typename ValueT::ObjectT *obj    = value.GetObject();
+                const typename ValueT::VItem   *h_item = obj->First();
+                const typename ValueT::VItem   *end    = (h_item + obj->Size());
+                NodeT                          *item   = next_node;
+                SizeT                           size{0};
+
+                while (h_item != end) {
+                    size += SizeT((h_item != nullptr) && !(h_item->Value.IsUndefined()));
+                    ++h_item;
+                }
+
+                node.items_ = item;
+                node.size_  = size;
+                next_node += ((size * SizeT{2}) + NodeT::tableUnits(size));
+                h_item = obj->First();
+
+                while (h_item != end) {
+                    if ((h_item != nullptr) && !(h_item->Value.IsUndefined())) {
+                        setString(*item, h_item->Key.First(), h_item->Key.Length(), next_text);
+                        fill(*(item + SizeT{1}), h_item->Value, next_node, next_text);
+                        item += SizeT{2};
+                    }
+
+                    ++h_item;
+                }
+
+                if (size >= NodeT::HashedMinimum) {
+                    fillTable(node);
+                }
+
+                break;
+            }
+
+            case ValueType::Array: {
+                const typename ValueT::ArrayT *arr  = value.GetArray();
+                NodeT                         *item = next_node;
+                SizeT                          size{0};
+
+                for (const ValueT &child : *arr) {
+                    size += SizeT(!(child.IsUndefined()));
+                }
+
+                node.items_ = item;
+                node.size_  = size;
+                next_node += size;
+
+                for (const ValueT &child : *arr) {
+                    if (!(child.IsUndefined())) {
+                        fill(*item, child, next_node, next_text);
+                        ++item;
+                    }
+                }
+
+                break;
+            }
+
+            case ValueType::String: {
+                const StringView<Char_T> str = value.GetStringView();
+                setString(node, str.First(), str.Length(), next_text);
+                break;
+            }
+
+            case ValueType::UIntLong:
+            case ValueType::IntLong:
+            case ValueType::Double: {
+                value.SetNumber(node.number_);
+                break;
+            }
+
+            default: {
+            }
+        }
+    }
+
+    static void fillTable(NodeT &node) noexcept {
+        using Slot = typename NodeT::Slot;
+
+        Slot       *slots = reinterpret_cast<Slot *>(const_cast<NodeT *>(node.items_ + (node.size_ * SizeT{2})));
+        const SizeT mask  = (NodeT::tableCapacity(node.size_) - SizeT{1});
+        SizeT       index{0};
+
+        MemoryUtils::SetToZeroByType(slots, (mask + SizeT{1}));
+
+        while (index < node.size_) {
+            const NodeT *key  = (node.items_ + (index * SizeT{2}));
+            const SizeT  hash = StringUtils::Hash(key->StringStorage(), key->size_);
+            SizeT        slot = (hash & mask);
+
+            while (slots[slot].Hash != 0) {
+                slot = ((slot + SizeT{1}) & mask);
+            }
+
+            slots[slot].Hash  = hash;
+            slots[slot].Index = index;
+            ++index;
+        }
+    }
+
+    void release() noexcept {
+        if (storage_ != nullptr) {
+            Reserver::Release(storage_, units_);
+        }
+    }
+
+    NodeT  root_{};
+    NodeT *storage_{nullptr};
+    SizeT  units_{0};
+};
+
+} // namespace Qentem
+
+#endif
@@ -418,7 +418,18 @@ struct Digit {
         SizeT offset = 0;
         number       = 0;
 
+        if constexpr ((sizeof(Char_T) == 1U) && (sizeof(Number_T) >= 4U)) {
+            SizeT32 eight;
+
+            while (((length - offset) >= 8U) && eightDigits((content + offset), eight)) {
+                number *= Number_T{100000000};
+                number += Number_T(eight);
+                offset += 8U;
+            }
+        }
+
         if (offset < length) {
+            number *= Number_T{10};
             number += Number_T(content[offset]);
             number -= Number_T{DigitUtils::DigitChar::Zero};
             ++offset;
@@ -662,6 +673,17 @@ struct Digit {
                 SizeT max_end_offset = tmp_offset;
                 ///////////////////////////////////////////////////////////
                 while (offset < end_offset) {
+                    if constexpr ((sizeof(Char_T) == 1U) && (sizeof(Number_T) == 8U)) {
+                        SizeT32 eight;
+
+                        while (((max_end_offset - offset) >= 8U) && eightDigits((content + offset), eight)) {
+                            number.Natural *= Number_T{100000000};
+                            number.Natural += Number_T(eight);
+                            offset += 8U;
+                            digit = content[offset - SizeT{1}];
+                        }
+                    }
+
                     while (offset < max_end_offset) {
                         digit = content[offset];
 
@@ -792,6 +814,7 @@ struct Digit {
 
                     SizeT32 exponent        = 0;
                     bool    is_negative_exp = false;
+                    bool    is_exact        = true; // No nonzero digit was left out of number.Natural.
                     bool    keep_going      = (offset < end_offset);
                     ///////////////////////////////////////////////////////////
                     tmp_offset   = dot_offset;
@@ -801,6 +824,7 @@ struct Digit {
                         digit = content[offset];
 
                         if ((digit >= DigitUtils::DigitChar::Zero) && (digit <= DigitUtils::DigitChar::Nine)) {
+                            is_exact &= (digit == DigitUtils::DigitChar::Zero);
                             ++offset;
                             keep_going = (offset < end_offset);
                             continue;
@@ -874,12 +898,14 @@ struct Digit {
                     }
 
                     //////////////////////////////////////////////////////////////
-                    BigInt<SystemLong, 256U> b_int{number.Natural};
-                    //////////////////////////////////////////////////////////////
-                    if (is_negative_exp) {
-                        powerOfNegativeTen<RealNumberInfo>(number.Natural, exponent, b_int);
-                    } else {
-                        powerOfPositiveTen<RealNumberInfo>(number.Natural, exponent, b_int);
+                    if (!(is_exact && fastPowerOfTen<RealNumberInfo>(number, exponent, is_negative_exp))) {
+                        BigInt<SystemLong, 256U> b_int{number.Natural};
+                        //////////////////////////////////////////////////////////////
+                        if (is_negative_exp) {
+                            powerOfNegativeTen<RealNumberInfo>(number.Natural, exponent, b_int);
+                        } else {
+                            powerOfPositiveTen<RealNumberInfo>(number.Natural, exponent, b_int);
+                        }
                     }
                 }
                 ///////////////////////////////////////
@@ -894,6 +920,68 @@ struct Digit {
         return QNumberType::NotANumber;
     }
     /////////////////////////////////////////
+    /*
+     * Reads eight digits at once (SWAR). Each byte is a digit when its high nibble is 3 and adding
+     * 6 does not carry out of it; the digits are then combined in pairs, then fours, then all eight.
+     */
+    template <typename Char_T>
+    QENTEM_INLINE static bool eightDigits(const Char_T *content, SizeT32 &value) noexcept {
+        // Written out so compilers see a single (little-endian) load.
+        SizeT64 chunk = (SizeT64(SizeT8(content[0])) | (SizeT64(SizeT8(content[1])) << 8U) |
+                         (SizeT64(SizeT8(content[2])) << 16U) | (SizeT64(SizeT8(content[3])) << 24U) |
+                         (SizeT64(SizeT8(content[4])) << 32U) | (SizeT64(SizeT8(content[5])) << 40U) |
+                         (SizeT64(SizeT8(content[6])) << 48U) | (SizeT64(SizeT8(content[7])) << 56U));
+
+        if (((chunk & 0xF0F0F0F0F0F0F0F0ULL) | (((chunk + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4U)) !=
+            0x3333333333333333ULL) {
+            return false;
+        }
+
+        chunk -= 0x3030303030303030ULL;
+        chunk = ((chunk * 10U) + (chunk >> 8U));
+        chunk = ((((chunk & 0x000000FF000000FFULL) * (100ULL + (1000000ULL << 32U))) +
+                  (((chunk >> 16U) & 0x000000FF000000FFULL) * (1ULL + (10000ULL << 32U)))) >>
+                 32U);
+
+        value = SizeT32(chunk);
+
+        return true;
+    }
+    /////////////////////////////////////////
+    /*
+     * Clinger's fast path: when the digits fit the mantissa and the power of ten is exact in the
+     * floating type, a single multiplication or division is correctly rounded, so BigInt is not
+     * needed. Only for float and double, and only where arithmetic is done at the type's own width.
+     */
+    template <typename RealNumberInfo_T, typename QNumber_T>
+    QENTEM_INLINE static bool fastPowerOfTen(QNumber_T &number, SizeT32 exponent, bool is_negative_exp) noexcept {
+        using Real_T = decltype(number.Real);
+
+#if !defined(__FLT_EVAL_METHOD__) || (__FLT_EVAL_METHOD__ == 0)
+        if constexpr ((sizeof(Real_T) == 4U) || (sizeof(Real_T) == 8U)) {
+            static constexpr double power_of_ten[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                                      1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                                      1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+            if ((exponent <= RealNumberInfo_T::MaxExactPowerOfTen) &&
+                (number.Natural <= (RealNumberInfo_T::MantissaWithLeadingBit + 1U))) {
+                const Real_T value = Real_T(number.Natural);
+                const Real_T power = Real_T(power_of_ten[exponent]);
+
+                number.Real = (is_negative_exp ? (value / power) : (value * power));
+
+                return true;
+            }
+        }
+#else
+        (void)exponent;
+        (void)is_negative_exp;
+#endif
+
+        (void)number;
+        return false;
+    }
+    /////////////////////////////////////////
     template <typename RealNumberInfo_T, typename Number_T, typename BigInt_T>
     static void powerOfNegativeTen(Number_T &number, SizeT32 exponent, BigInt_T &b_int) noexcept {
         using DigitConst = DigitUtils::DigitConst<sizeof(SystemLong)>;
@@ -305,6 +305,7 @@ struct RealNumberInfo<Number_T, 4U> {
     static constexpr SizeT32 LeadingBit             = 0x00800000U;
     static constexpr SizeT64 MantissaWithLeadingBit = 0x00FFFFFFU;
     static constexpr SizeT32 MaxCut                 = 30U;
+    static constexpr SizeT32 MaxExactPowerOfTen     = 10U; // 5**10 < 2**24
 };
 
 // double
@@ -321,6 +322,7 @@ struct RealNumberInfo<Number_T, 8U> {
     static constexpr SizeT64 LeadingBit             = 0x0010000000000000ULL;
     static constexpr SizeT64 MantissaWithLeadingBit = 0x001FFFFFFFFFFFFFULL;
     static constexpr SizeT32 MaxCut                 = 300U;
+    static constexpr SizeT32 MaxExactPowerOfTen     = 22U; // 5**22 < 2**53
 };
 
 #if defined(QENTEM_ENABLE_FLOAT_128) && (QENTEM_ENABLE_FLOAT_128 == 1)
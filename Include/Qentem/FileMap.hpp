@@ -0,0 +1,145 @@
+/**
+ * @file FileMap.hpp
+ * @brief Read-only memory mapping of a whole file.
+ *
+ * FileMap maps a file into memory instead of reading it into a buffer, so its pages come
+ * straight from the page cache and are never copied. The mapping is advised as sequential,
+ * which suits a parser reading from start to end.
+ *
+ * On Linux the raw syscall layer is used (openat, lseek, mmap through SystemMemory::ReserveEx,
+ * madvise, close), with no libc involved. Other POSIX systems use their mmap; elsewhere
+ * Open() fails.
+ *
+ * @copyright Copyright (c) 2026 Hani Ammar
+ * @license MIT
+ */
+
+#ifndef QENTEM_FILE_MAP_H
+#define QENTEM_FILE_MAP_H
+
+#include "Qentem/SystemMemory.hpp"
+
+// clang-format off
+#if !defined(_WIN32) && !defined(__linux__) && !defined(QENTEM_SYSTEM_MEMORY_FALLBACK)
+    #include <fcntl.h>
+#endif
+// clang-format on
+
+namespace Qentem {
+
+struct FileMap {
+    FileMap() noexcept = default;
+
+    FileMap(const FileMap &)            = delete;
+    FileMap &operator=(const FileMap &) = delete;
+
+    ~FileMap() {
+        Close();
+    }
+
+    /**
+     * @brief Maps the file at path, replacing any previous mapping.
+     *
+     * An empty file opens successfully with no content.
+     *
+     * @return false if the file could not be opened or mapped.
+     */
+    bool Open(const char *path) noexcept {
+        Close();
+
+        // clang-format off
+#if defined(__linux__)
+        const int fd = static_cast<int>(
+            SystemCall(__NR_openat, Q_AT_FDCWD, reinterpret_cast<SystemLongI>(path), (Q_RDONLY | Q_CLOEXEC), 0));
+
+        if (fd < 0) {
+            return false;
+        }
+
+        const SystemLongI size = SystemCall(__NR_lseek, fd, 0, Q_SEEK_END);
+        bool              ok   = (size >= 0);
+
+        if (ok && (size != 0)) {
+            const SystemLongI address =
+                SystemMemory::ReserveEx(nullptr, static_cast<SystemLong>(size), PROT_READ, MAP_PRIVATE, fd, 0);
+
+            // Errors come back as -errno, which sits in the last page of the address space.
+            ok = ((address >= 0) || (address <= -4096));
+
+            if (ok) {
+                content_ = reinterpret_cast<const char *>(address);
+                length_  = static_cast<SystemLong>(size);
+                SystemCall(__NR_madvise, address, length_, MADV_SEQUENTIAL);
+            }
+        }
+
+        SystemCall(__NR_close, fd);
+
+        return ok;
+#elif !defined(_WIN32) && !defined(QENTEM_SYSTEM_MEMORY_FALLBACK)
+        const int fd = ::open(path, (O_RDONLY | O_CLOEXEC));
+
+        if (fd < 0) {
+            return false;
+        }
+
+        const off_t size = ::lseek(fd, 0, SEEK_END);
+        bool        ok   = (size >= 0);
+
+        if (ok && (size != 0)) {
+            void *address = ::mmap(nullptr, static_cast<SystemLong>(size), PROT_READ, MAP_PRIVATE, fd, 0);
+            ok            = (address != MAP_FAILED);
+
+            if (ok) {
+                content_ = static_cast<const char *>(address);
+                length_  = static_cast<SystemLong>(size);
+                ::madvise(address, length_, MADV_SEQUENTIAL);
+            }
+        }
+
+        ::close(fd);
+
+        return ok;
+#else
+        (void)path;
+        return false;
+#endif
+        // clang-format on
+    }
+
+    void Close() noexcept {
+        if (content_ != nullptr) {
+            // Unmapped here rather than by SystemMemory::Release(), which frees through the heap
+            // when QENTEM_SYSTEM_MEMORY_FALLBACK is defined; a mapping never came from there.
+            // clang-format off
+#if defined(__linux__)
+            SystemCall(__NR_munmap, reinterpret_cast<SystemLongI>(content_), length_);
+#elif !defined(_WIN32) && !defined(QENTEM_SYSTEM_MEMORY_FALLBACK)
+            ::munmap(const_cast<char *>(content_), length_);
+#endif
+            // clang-format on
+            content_ = nullptr;
+            length_  = 0;
+        }
+    }
+
+    QENTEM_INLINE const char *Content() const noexcept {
+        return content_;
+    }
+
+    QENTEM_INLINE SystemLong Length() const noexcept {
+        return length_;
+    }
+
+    QENTEM_INLINE bool IsEmpty() const noexcept {
+        return (length_ == 0);
+    }
+
+  private:
+    const char *content_{nullptr};
+    SystemLong  length_{0};
+};
+
+} // namespace Qentem
+
+#endif
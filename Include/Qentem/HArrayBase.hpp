@@ -207,6 +207,18 @@ struct HArrayBase : public AutoHashTable<Key_T, Number_T, HAItem_T<Key_T, Number
         return item->Value;
     }
 
+    /**
+     * @brief Gets (or inserts) a value by moved key object whose hash is already known.
+     *
+     * @param key  The key object to move.
+     * @param hash The precomputed hash value of the key.
+     * @return Reference to the value.
+     */
+    QENTEM_INLINE Value_T &Get(Key_T &&key, const NumberT hash) {
+        HItem *item = tryInsert(QUtility::Move(key), hash);
+        return item->Value;
+    }
+
     /**
      * @brief Array subscript operator by moved key object.
      *
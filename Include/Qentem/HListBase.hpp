@@ -170,6 +170,17 @@ struct HListBase
     QENTEM_INLINE void operator[](const Key_T &key) {
         tryInsert(key);
     }
+
+    /**
+     * @brief Inserts a moved key whose hash is already known, if not present.
+     *
+     * @param key  The key object to move.
+     * @param hash The precomputed hash value of the key.
+     * @return The stored key.
+     */
+    QENTEM_INLINE const Key_T &Get(Key_T &&key, const Number_T hash) {
+        return tryInsert(QUtility::Move(key), hash)->Key;
+    }
 };
 
 /**
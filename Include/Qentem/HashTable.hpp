@@ -737,14 +737,36 @@ struct HashTable {
      * @note
      * The sorting is stable and preserves key/value associations. After sorting,
      * all hash buckets are reset and rebuilt for consistency.
+     *
+     * Keys are merge-sorted through (item, index) pairs, and each item is then moved once
+     * into its place; items do not move while being compared, and sorted input costs no more
+     * than any other. Room for a copy of the items is reserved while sorting.
      */
     void Sort(const bool ascend = true) noexcept {
-        HItem_T *storage = Storage();
+        HItem_T      *storage = Storage();
+        const NumberT size    = Size();
 
-        if (ascend) {
-            QUtility::Sort<true>(storage, NumberT{0}, Size()); // Sort in ascending order
-        } else {
-            QUtility::Sort<false>(storage, NumberT{0}, Size()); // Sort in descending order
+        if (size > NumberT{1}) {
+            using SortEntry = QUtility::SortEntry<QUtility::SortRef<HItem_T>, NumberT>;
+
+            NumberT    count   = (size * NumberT{2});
+            NumberT    length  = size;
+            SortEntry *entries = MemoryProvider_T::template Reserve<SortEntry>(count);
+            HItem_T   *scratch = MemoryProvider_T::template Reserve<HItem_T>(length);
+            SortEntry *sorted;
+
+            for (NumberT index = 0; index < size; index++) {
+                entries[index].Key.Data = (storage + index);
+                entries[index].Index    = index;
+            }
+
+            sorted = QUtility::SortEntries(entries, (entries + size), size, ascend);
+
+            // Items move once, to their place, after all comparing is done.
+            MemoryUtils::Gather(scratch, storage, sorted, size);
+            MemoryUtils::CopyTo(storage, scratch, size);
+            MemoryProvider_T::Release(scratch, length);
+            MemoryProvider_T::Release(entries, count);
         }
 
         // Reset hash table mapping and rebuild
@@ -1346,6 +1368,31 @@ struct HashTable {
         return item;
     }
 
+    /**
+     * @brief Finds or inserts an item by key (move) whose hash is already known.
+     *
+     * For a key hashed once and inserted into many tables, such as a column name.
+     *
+     * @param[in] key  The key to find or insert (moved).
+     * @param[in] hash The hash of the key, as KeyUtils_T::Hash() gives it.
+     * @return Pointer to the existing or newly inserted item.
+     */
+    HItem_T *tryInsert(Key_T &&key, const NumberT hash) noexcept {
+        if (Size() == Capacity()) {
+            expand(Capacity() * Expansion_Multiplier_T); // Grow the table if needed
+        }
+
+        NumberT *index;
+        HItem_T *item = find(index, key, hash);
+
+        if (item == nullptr) {
+            item = insert(index, QUtility::Move(key), hash); // Insert new item, moving key
+            item->InitValue();                               // Ensure value is properly initialized
+        }
+
+        return item;
+    }
+
     /**
      * @brief Removes the given item from the hash table by direct pointer and index slot.
      *
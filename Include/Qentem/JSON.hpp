@@ -8,6 +8,18 @@
  * deeply nested structures. Optional support for C-style line and block
  * comments is provided as a preprocessing step.
  *
+ * JSON::Walk reads a structural index (JSONIndex) as a SAX-style reader: it reports
+ * keys, values and container bounds to a handler instead of building a Value, in
+ * memory that only grows with the nesting depth. A handler can have values skipped
+ * by bracket matching, unread.
+ *
+ * Given a JSONPaths set, JSON::Parse walks the document with a handler that builds
+ * only the selected parts and has the rest skipped.
+ *
+ * For newline-delimited JSON (JSON Lines), JSON::ForEachLine finds the records,
+ * JSON::ParseLines parses them one by one, and JSON::SplitLines cuts a buffer into
+ * line-aligned ranges for worker threads.
+ *
  * @copyright Copyright (c) 2026 Hani Ammar
  * @license MIT
  */
@@ -16,9 +28,68 @@
 #define QENTEM_JSON_H
 
 #include "Qentem/Value.hpp"
+#include "Qentem/JSONIndex.hpp"
+#include "Qentem/JSONPaths.hpp"
+#include "Qentem/FileMap.hpp"
+#include "Qentem/KeyTable.hpp"
 
 namespace Qentem {
 
+/**
+ * @brief Callbacks for JSON::Walk that accept everything and keep nothing.
+ *
+ * A handler derives from it and hides the callbacks it cares about; the calls are resolved
+ * at compile time. Each callback returns true to go on or false to stop the walk. Strings
+ * and keys arrive unescaped and are only valid for the duration of the call.
+ */
+template <typename Char_T>
+struct JSONHandler {
+    /*
+     * Asked before each value below the root, after its key in an object. Returning true steps
+     * over the value with no callbacks for it; only its brackets and quotes are checked.
+     */
+    QENTEM_INLINE bool SkipValue(bool) noexcept {
+        return false;
+    }
+
+    QENTEM_INLINE bool OnStartObject() noexcept {
+        return true;
+    }
+
+    QENTEM_INLINE bool OnEndObject() noexcept {
+        return true;
+    }
+
+    QENTEM_INLINE bool OnStartArray() noexcept {
+        return true;
+    }
+
+    QENTEM_INLINE bool OnEndArray() noexcept {
+        return true;
+    }
+
+    QENTEM_INLINE bool OnKey(const Char_T *, SizeT) noexcept {
+        return true;
+    }
+
+    QENTEM_INLINE bool OnString(const Char_T *, SizeT) noexcept {
+        return true;
+    }
+
+    // type is Natural (number.Natural), Integer (number.Integer) or Real (number.Real).
+    QENTEM_INLINE bool OnNumber(const QNumber64 &, QNumberType) noexcept {
+        return true;
+    }
+
+    QENTEM_INLINE bool OnBool(bool) noexcept {
+        return true;
+    }
+
+    QENTEM_INLINE bool OnNull() noexcept {
+        return true;
+    }
+};
+
 struct JSON {
     template <typename Stream_T, typename Char_T, typename Number_T>
     QENTEM_INLINE static Value<Char_T> Parse(Stream_T &stream, const Char_T *content, Number_T length) {
@@ -52,15 +123,407 @@ struct JSON {
         return ParseWithComments(content, StringUtils::Count(content));
     }
 
+    /**
+     * @brief Parses without copying strings and keys that have nothing to unescape.
+     *
+     * Such strings borrow their text from content (see String::Borrow), so content must
+     * outlive the returned value and stay unchanged; only escaped strings are copied.
+     */
+    template <typename Stream_T, typename Char_T, typename Number_T>
+    QENTEM_INLINE static Value<Char_T> ParseBorrowed(Stream_T &stream, const Char_T *content, Number_T length) {
+        return parse<Stream_T, Char_T, false, true>(stream, content, SizeT(length));
+    }
+
+    template <typename Char_T, typename Number_T>
+    QENTEM_INLINE static Value<Char_T> ParseBorrowed(const Char_T *content, Number_T length) {
+        StringStream<Char_T> stream;
+        return ParseBorrowed(stream, content, SizeT(length));
+    }
+
+    /**
+     * @brief Parses with object keys interned through keys (see KeyTable).
+     *
+     * Objects with the same keys, as in an array of records, then share one copy of each
+     * key, and each key is hashed once for both the table and the object. keys must outlive
+     * the returned value, and can be passed to more parses to share the same copies.
+     */
+    template <typename Stream_T, typename Char_T, typename Number_T>
+    QENTEM_INLINE static Value<Char_T> ParseInterned(Stream_T &stream, const Char_T *content, Number_T length,
+                                                     KeyTable<Char_T> &keys) {
+        return parse(stream, content, SizeT(length), &keys);
+    }
+
+    template <typename Char_T, typename Number_T>
+    QENTEM_INLINE static Value<Char_T> ParseInterned(const Char_T *content, Number_T length, KeyTable<Char_T> &keys) {
+        StringStream<Char_T> stream;
+        return ParseInterned(stream, content, SizeT(length), keys);
+    }
+
+    /**
+     * @brief Parses a file through a read-only memory mapping, without reading it into a buffer.
+     *
+     * Strings with nothing to unescape borrow from the mapping (see ParseBorrowed), so the
+     * value is valid only while file stays open.
+     */
+    static Value<char> ParseFile(const char *path, FileMap &file) {
+        if (file.Open(path) && (file.Length() <= SystemLong(~SizeT{0}))) {
+            return ParseBorrowed(file.Content(), SizeT(file.Length()));
+        }
+
+        return Value<char>{};
+    }
+
+    /**
+     * @brief Parses a file through a memory mapping that is released before returning.
+     */
+    static Value<char> ParseFile(const char *path) {
+        FileMap file;
+
+        if (file.Open(path) && (file.Length() <= SystemLong(~SizeT{0}))) {
+            return Parse(file.Content(), SizeT(file.Length()));
+        }
+
+        return Value<char>{};
+    }
+
+    /**
+     * @brief Parses only the parts of the document selected by paths.
+     *
+     * Objects and arrays on the way to a selected value are kept with just the selected
+     * members (an array keeps only the matching items, in order), and a selected value is
+     * parsed whole. Everything else is skipped without unescaping or reading numbers, so
+     * it is only checked for balanced brackets and quotes.
+     */
+    template <typename Stream_T, typename Char_T, typename Number_T>
+    QENTEM_INLINE static Value<Char_T> Parse(Stream_T &stream, const Char_T *content, Number_T length,
+                                             const JSONPaths<Char_T> &paths) {
+        Value<Char_T> value{};
+
+        if (!parseProjected(value, stream, content, SizeT(length), paths.Root())) {
+            value.Reset();
+        }
+
+        return value;
+    }
+
+    template <typename Char_T, typename Number_T>
+    QENTEM_INLINE static Value<Char_T> Parse(const Char_T *content, Number_T length, const JSONPaths<Char_T> &paths) {
+        StringStream<Char_T> stream;
+        return Parse(stream, content, SizeT(length), paths);
+    }
+
+    /**
+     * @brief Reads a document without building a Value, passing each token to handler.
+     *
+     * @return true if the whole document was valid JSON and no callback stopped the walk.
+     * @see JSONHandler
+     */
+    template <typename Handler_T, typename Stream_T, typename Char_T, typename Number_T>
+    QENTEM_INLINE static bool Walk(Handler_T &handler, Stream_T &stream, const Char_T *content, Number_T length) {
+        return walk(handler, stream, content, SizeT(length));
+    }
+
+    template <typename Handler_T, typename Char_T, typename Number_T>
+    QENTEM_INLINE static bool Walk(Handler_T &handler, const Char_T *content, Number_T length) {
+        StringStream<Char_T> stream;
+        return walk(handler, stream, content, SizeT(length));
+    }
+
+    /**
+     * @brief Calls callback(line, line_length, offset) for every line that is not blank.
+     *
+     * offset is where the line starts in content. JSON strings cannot hold a raw line break,
+     * so every line feed ends a record.
+     *
+     * @return The number of lines passed to callback.
+     */
+    template <typename Callback_T, typename Char_T, typename Number_T>
+    static SizeT ForEachLine(const Char_T *content, Number_T length, Callback_T &&callback) {
+        using WhiteSpaceChars = StringUtils::WhiteSpaceChars_T<Char_T>;
+
+        SizeT count  = 0;
+        SizeT offset = 0;
+
+        while (offset < SizeT(length)) {
+            const SizeT end   = findLineEnd(content, offset, SizeT(length));
+            SizeT       first = offset;
+
+            while ((first < end) && ((content[first] == WhiteSpaceChars::SpaceChar) ||
+                                     (content[first] == WhiteSpaceChars::TabControlChar) ||
+                                     (content[first] == WhiteSpaceChars::CarriageControlChar))) {
+                ++first;
+            }
+
+            if (first != end) {
+                callback((content + offset), (end - offset), offset);
+                ++count;
+            }
+
+            offset = (end + SizeT{1});
+        }
+
+        return count;
+    }
+
+    /**
+     * @brief Parses JSON Lines, calling callback(value, offset) for each record in order.
+     *
+     * A line that is not valid JSON gives an undefined value. Values are allocated by the
+     * calling thread and must be released by it.
+     *
+     * @return The number of records passed to callback.
+     */
+    template <typename Callback_T, typename Char_T, typename Number_T>
+    static SizeT ParseLines(const Char_T *content, Number_T length, Callback_T &&callback) {
+        LineParser<Callback_T, Char_T> line_parser{callback};
+
+        return ForEachLine(content, length, line_parser);
+    }
+
+    /**
+     * @brief Splits content into at most parts ranges of about the same size, each ending at a line break.
+     *
+     * Each range can be handed to its own thread and parsed with ParseLines there; since the
+     * Reserver arena is per thread, the workers do not contend for memory. Records keep their
+     * order within a range, and ranges are in order.
+     */
+    template <typename Char_T, typename Number_T>
+    static void SplitLines(const Char_T *content, Number_T length, SizeT parts, Array<StringView<Char_T>> &ranges) {
+        const SizeT total  = SizeT(length);
+        SizeT       offset = 0;
+
+        if (parts == 0) {
+            parts = 1;
+        }
+
+        const SizeT step = ((total / parts) + SizeT{1});
+
+        while ((offset < total) && (parts != 0)) {
+            SizeT end = total;
+
+            if (parts != 1) {
+                end = (offset + step);
+
+                if (end < total) {
+                    end = findLineEnd(content, end, total);
+
+                    if (end < total) {
+                        ++end; // Keep the line feed with its line.
+                    }
+                } else {
+                    end = total;
+                }
+            }
+
+            ranges += StringView<Char_T>{(content + offset), (end - offset)};
+            offset = end;
+            --parts;
+        }
+    }
+
   private:
-    template <typename Stream_T, typename Char_T, bool WithComments_T = false>
-    static Value<Char_T> parse(Stream_T &stream, const Char_T *content, SizeT length) {
+    template <typename Callback_T, typename Char_T>
+    struct LineParser {
+        explicit LineParser(Callback_T &callback) noexcept : callback_{callback} {
+        }
+
+        void operator()(const Char_T *line, SizeT line_length, SizeT offset) {
+            Value<Char_T> value = parse(stream_, line, line_length);
+            stream_.Clear();
+            callback_(value, offset);
+        }
+
+      private:
+        Callback_T          &callback_;
+        StringStream<Char_T> stream_{};
+    };
+
+    /*
+     * Keeps the selected parts of a walk. Each open container remembers its path node; a null
+     * node means the container was selected whole.
+     */
+    template <typename ValueT, typename Char_T>
+    struct ProjectionHandler : JSONHandler<Char_T> {
+        using NodeT   = JSONPathNode<Char_T>;
+        using ObjectT = typename ValueT::ObjectT;
+        using ArrayT  = typename ValueT::ArrayT;
+
+        ProjectionHandler(ValueT &value, const NodeT &root) noexcept : item_{&value}, node_{&root} {
+        }
+
+        bool SkipValue(const bool is_container) {
+            if (arr_ != nullptr) {
+                selectNode(current_.Node, ((current_.Node != nullptr) ? current_.Node->FindIndex(current_.Index)
+                                                                      : nullptr));
+                ++current_.Index;
+            }
+
+            // A partly selected value has to be a container to hold the rest of its path.
+            if (!selected_ || ((node_ != nullptr) && !is_container)) {
+                return true;
+            }
+
+            if (obj_ != nullptr) {
+                item_ = &((*obj_)[QUtility::Move(key_)]);
+            } else {
+                item_ = &(arr_->Insert(ValueT{}));
+            }
+
+            return false;
+        }
+
+        // The key is added with its value, as a partly selected one may not be kept.
+        bool OnKey(const Char_T *key, SizeT length) {
+            selectNode(current_.Node, ((current_.Node != nullptr) ? current_.Node->FindKey(key, length) : nullptr));
+
+            if (selected_) {
+                key_ = String<Char_T>{key, length};
+            }
+
+            return true;
+        }
+
+        QENTEM_INLINE bool OnStartObject() {
+            open(ValueType::Object);
+            return true;
+        }
+
+        QENTEM_INLINE bool OnStartArray() {
+            open(ValueType::Array);
+            return true;
+        }
+
+        QENTEM_INLINE bool OnEndObject() {
+#if QENTEM_VALUE_EXPANSION_MULTIPLIER > 2U
+            obj_->RemoveExcessStorage();
+#endif
+            close();
+            return true;
+        }
+
+        QENTEM_INLINE bool OnEndArray() {
+            arr_->Compress();
+            close();
+            return true;
+        }
+
+        QENTEM_INLINE bool OnString(const Char_T *str, SizeT length) {
+            *item_ = ValueT{String<Char_T>{str, length}};
+            return true;
+        }
+
+        QENTEM_INLINE bool OnNumber(const QNumber64 &number, QNumberType type) {
+            if (type == QNumberType::Natural) {
+                *item_ = ValueT{number.Natural};
+            } else if (type == QNumberType::Integer) {
+                *item_ = ValueT{number.Integer};
+            } else {
+                *item_ = ValueT{number.Real};
+            }
+
+            return true;
+        }
+
+        QENTEM_INLINE bool OnBool(bool value) {
+            *item_ = ValueT{value ? ValueType::True : ValueType::False};
+            return true;
+        }
+
+        QENTEM_INLINE bool OnNull() {
+            *item_ = ValueT{ValueType::Null};
+            return true;
+        }
+
+      private:
+        struct Frame {
+            ValueT      *Parent;
+            const NodeT *Node;
+            SizeT        Index;
+        };
+
+        // Without a parent node the value is inside one selected whole.
+        QENTEM_INLINE void selectNode(const NodeT *parent, const NodeT *node) noexcept {
+            node_     = node;
+            selected_ = ((parent == nullptr) || (node != nullptr));
+
+            if ((node_ != nullptr) && node_->IsEnd) {
+                node_ = nullptr;
+            }
+        }
+
+        void open(ValueType type) {
+            *item_ = ValueT{type};
+
+            if (current_.Parent != nullptr) {
+                tree_ += current_;
+            }
+
+            current_ = Frame{item_, node_, 0};
+            obj_     = item_->GetObject();
+            arr_     = item_->GetArray();
+        }
+
+        void close() noexcept {
+            Frame *last = tree_.Last();
+
+            if (last != nullptr) {
+                current_ = *last;
+                tree_.Drop(SizeT{1});
+                obj_ = current_.Parent->GetObject();
+                arr_ = current_.Parent->GetArray();
+            }
+        }
+
+        Array<Frame>   tree_{SizeT{8}};
+        Frame          current_{nullptr, nullptr, 0};
+        String<Char_T> key_{};
+        ValueT        *item_;
+        const NodeT   *node_;
+        ObjectT       *obj_{nullptr};
+        ArrayT        *arr_{nullptr};
+        bool           selected_{true};
+    };
+
+    // The offset of the next line feed, or length.
+    template <typename Char_T>
+    static SizeT findLineEnd(const Char_T *content, SizeT offset, const SizeT length) noexcept {
+        using NotationConstants = JSONUtils::NotationConstants_T<Char_T>;
+
+        if constexpr (QentemConfig::IsSIMDEnabled && (sizeof(Char_T) == 1U)) {
+            using SIMD  = Platform::SIMD;
+            using VAR_T = typename SIMD::VAR_T;
+
+            const VAR_T m_line = SIMD::SetToOne8Bit(NotationConstants::LineControlChar);
+
+            while ((length - offset) >= SIMD::Size) {
+                const SizeT32 bits =
+                    SIMD::Compare8Bit(SIMD::Load(reinterpret_cast<const VAR_T *>(content + offset)), m_line);
+
+                if (bits != 0) {
+                    return (offset + Platform::FindFirstBit(bits));
+                }
+
+                offset += SIMD::Size;
+            }
+        }
+
+        while ((offset < length) && (content[offset] != NotationConstants::LineControlChar)) {
+            ++offset;
+        }
+
+        return offset;
+    }
+
+    template <typename Stream_T, typename Char_T, bool WithComments_T = false, bool Borrow_T = false>
+    static Value<Char_T> parse(Stream_T &stream, const Char_T *content, SizeT length,
+                               KeyTable<Char_T> *keys = nullptr) {
         using WhiteSpaceChars = StringUtils::WhiteSpaceChars_T<Char_T>;
         Value<Char_T> value{};
 
         if (length != 0) {
             SizeT offset = 0;
-            parse<Value<Char_T>, Stream_T, Char_T, WithComments_T>(value, stream, content, offset, length);
+            parse<Value<Char_T>, Stream_T, Char_T, WithComments_T, Borrow_T>(value, stream, content, offset, length,
+                                                                              keys);
 
             if constexpr (WithComments_T) {
                 while (true) {
@@ -114,8 +577,396 @@ struct JSON {
         return value;
     }
 
-    template <typename ValueT, typename Stream_T, typename Char_T, bool WithComments_T = false>
-    static void parse(ValueT &value, Stream_T &stream, const Char_T *content, SizeT &offset, const SizeT length) {
+    // Builds a value from the walk, guided by a path tree.
+    template <typename ValueT, typename Stream_T, typename Char_T>
+    QENTEM_INLINE static bool parseProjected(ValueT &value, Stream_T &stream, const Char_T *content,
+                                             const SizeT length, const JSONPathNode<Char_T> &root) {
+        ProjectionHandler<ValueT, Char_T> handler{value, root};
+        return walk(handler, stream, content, length);
+    }
+
+    /*
+     * Steps over a value whose first token ch has been taken. Inside strings the index only
+     * holds backslashes, controls and the closing quote, so a string ends at its next quote
+     * token and a container at its matching bracket.
+     */
+    template <typename Char_T>
+    static bool skipValue(JSONIndex<Char_T> &index, const Char_T *content, const SizeT length, const Char_T ch) {
+        using NotationConstants = JSONUtils::NotationConstants_T<Char_T>;
+
+        SizeT depth = 0;
+        SizeT offset;
+
+        switch (ch) {
+            case NotationConstants::QuoteChar: {
+                break;
+            }
+
+            case NotationConstants::SCurlyChar:
+            case NotationConstants::SSquareChar: {
+                depth = 1;
+                break;
+            }
+
+            case NotationConstants::CommaChar:
+            case NotationConstants::ColonChar:
+            case NotationConstants::ECurlyChar:
+            case NotationConstants::ESquareChar: {
+                return false;
+            }
+
+            default: {
+                return true; // A scalar; the next token is what follows it.
+            }
+        }
+
+        bool in_string = (ch == NotationConstants::QuoteChar);
+
+        while ((offset = index.Current()) != length) {
+            const Char_T current = content[offset];
+            index.Next();
+
+            if (in_string) {
+                if (current == NotationConstants::QuoteChar) {
+                    if (depth == 0) {
+                        return true;
+                    }
+
+                    in_string = false;
+                }
+
+                continue;
+            }
+
+            switch (current) {
+                case NotationConstants::QuoteChar: {
+                    in_string = true;
+                    break;
+                }
+
+                case NotationConstants::SCurlyChar:
+                case NotationConstants::SSquareChar: {
+                    ++depth;
+                    break;
+                }
+
+                case NotationConstants::ECurlyChar:
+                case NotationConstants::ESquareChar: {
+                    --depth;
+
+                    if (depth == 0) {
+                        return true;
+                    }
+
+                    break;
+                }
+
+                default: {
+                }
+            }
+        }
+
+        return false;
+    }
+
+    /*
+     * Reads strict JSON from the structural index without building anything, with the open
+     * containers kept as one flag per level.
+     */
+    template <typename Handler_T, typename Stream_T, typename Char_T>
+    static bool walk(Handler_T &handler, Stream_T &stream, const Char_T *content, const SizeT length) {
+        using NotationConstants = JSONUtils::NotationConstants_T<Char_T>;
+
+        enum struct Expecting : SizeT8 { KeyOrEnd, Key, Colon, ValueOrEnd, Value, CommaOrEnd };
+
+        JSONIndex<Char_T> index{content, length};
+        SizeT             offset = index.Current();
+
+        if (offset == length) {
+            return false;
+        }
+
+        bool in_object = (content[offset] == NotationConstants::SCurlyChar);
+
+        if (in_object) {
+            if (!handler.OnStartObject()) {
+                return false;
+            }
+        } else if ((content[offset] != NotationConstants::SSquareChar) || !handler.OnStartArray()) {
+            return false;
+        }
+
+        index.Next();
+
+        Array<bool> tree{SizeT{8}};
+        Expecting   expecting{in_object ? Expecting::KeyOrEnd : Expecting::ValueOrEnd};
+
+        while ((offset = index.Current()) != length) {
+            const Char_T ch = content[offset];
+            index.Next();
+
+            switch (expecting) {
+                case Expecting::KeyOrEnd:
+                case Expecting::Key: {
+                    if (ch == NotationConstants::QuoteChar) {
+                        const Char_T *str;
+                        SizeT         len;
+
+                        if (!indexedString(index, stream, content, offset, length, str, len) ||
+                            !handler.OnKey(str, len)) {
+                            return false;
+                        }
+
+                        stream.Clear();
+                        expecting = Expecting::Colon;
+                        continue;
+                    }
+
+                    if ((ch == NotationConstants::ECurlyChar) && (expecting == Expecting::KeyOrEnd)) {
+                        break; // End of the object.
+                    }
+
+                    return false;
+                }
+
+                case Expecting::Colon: {
+                    if (ch == NotationConstants::ColonChar) {
+                        expecting = Expecting::Value;
+                        continue;
+                    }
+
+                    return false;
+                }
+
+                case Expecting::ValueOrEnd:
+                case Expecting::Value: {
+                    if ((ch == NotationConstants::ESquareChar) && (expecting == Expecting::ValueOrEnd)) {
+                        break; // End of the array.
+                    }
+
+                    expecting = Expecting::CommaOrEnd;
+
+                    if (handler.SkipValue((ch == NotationConstants::SCurlyChar) ||
+                                          (ch == NotationConstants::SSquareChar))) {
+                        stream.Clear();
+
+                        if (!skipValue(index, content, length, ch)) {
+                            return false;
+                        }
+
+                        continue;
+                    }
+
+                    switch (ch) {
+                        case NotationConstants::QuoteChar: {
+                            const Char_T *str;
+                            SizeT         len;
+
+                            if (!indexedString(index, stream, content, offset, length, str, len) ||
+                                !handler.OnString(str, len)) {
+                                return false;
+                            }
+
+                            stream.Clear();
+                            continue;
+                        }
+
+                        case NotationConstants::SSquareChar:
+                        case NotationConstants::SCurlyChar: {
+                            tree += in_object;
+                            in_object = (ch == NotationConstants::SCurlyChar);
+
+                            if (!(in_object ? handler.OnStartObject() : handler.OnStartArray())) {
+                                return false;
+                            }
+
+                            expecting = (in_object ? Expecting::KeyOrEnd : Expecting::ValueOrEnd);
+                            continue;
+                        }
+
+                        case NotationConstants::T_Char: {
+                            if (!indexedLiteral(content, offset, length, NotationConstants::TrueString,
+                                                NotationConstants::TrueStringLength) ||
+                                !handler.OnBool(true)) {
+                                return false;
+                            }
+
+                            continue;
+                        }
+
+                        case NotationConstants::F_Char: {
+                            if (!indexedLiteral(content, offset, length, NotationConstants::FalseString,
+                                                NotationConstants::FalseStringLength) ||
+                                !handler.OnBool(false)) {
+                                return false;
+                            }
+
+                            continue;
+                        }
+
+                        case NotationConstants::N_Char: {
+                            if (!indexedLiteral(content, offset, length, NotationConstants::NullString,
+                                                NotationConstants::NullStringLength) ||
+                                !handler.OnNull()) {
+                                return false;
+                            }
+
+                            continue;
+                        }
+
+                        default: {
+                            QNumber64         number;
+                            const QNumberType type = Digit::StringToNumber(number, content, offset, length);
+
+                            if ((type == QNumberType::NotANumber) || !indexedScalarEnd(content, offset, length) ||
+                                !handler.OnNumber(number, type)) {
+                                return false;
+                            }
+
+                            continue;
+                        }
+                    }
+                }
+
+                case Expecting::CommaOrEnd: {
+                    if (ch == NotationConstants::CommaChar) {
+                        expecting = (in_object ? Expecting::Key : Expecting::Value);
+                        continue;
+                    }
+
+                    if ((in_object && (ch == NotationConstants::ECurlyChar)) ||
+                        (!in_object && (ch == NotationConstants::ESquareChar))) {
+                        break; // End of the container.
+                    }
+
+                    return false;
+                }
+            }
+
+            // Closing the current container.
+            if (!(in_object ? handler.OnEndObject() : handler.OnEndArray())) {
+                return false;
+            }
+
+            bool *last = tree.Last();
+
+            if (last == nullptr) {
+                return (index.Current() == length);
+            }
+
+            in_object = *last;
+            tree.Drop(SizeT{1});
+            expecting = Expecting::CommaOrEnd;
+        }
+
+        return false;
+    }
+
+    // 'offset' is at the opening quote. A string with nothing to unescape ends at the next token.
+    template <typename Stream_T, typename Char_T>
+    static bool indexedString(JSONIndex<Char_T> &index, Stream_T &stream, const Char_T *content, SizeT offset,
+                              const SizeT length, const Char_T *&str, SizeT &len) {
+        ++offset;
+
+        const SizeT end = index.Current();
+
+        if ((end != length) && (content[end] == JSONUtils::NotationConstants_T<Char_T>::QuoteChar)) {
+            index.Next();
+            str = (content + offset);
+            len = (end - offset);
+            return true;
+        }
+
+        str = (content + offset);
+        len = JSONUtils::UnEscape(str, (length - offset), stream);
+
+        if ((len == 0) || (content[offset + len - SizeT{1}] != JSONUtils::NotationConstants_T<Char_T>::QuoteChar)) {
+            return false;
+        }
+
+        index.SkipTo(offset + len);
+        --len;
+
+        if (stream.IsNotEmpty()) {
+            str = stream.First();
+            len = stream.Length();
+        }
+
+        return true;
+    }
+
+    template <typename Char_T>
+    static bool indexedLiteral(const Char_T *content, SizeT offset, const SizeT length, const Char_T *literal,
+                               const SizeT literal_length) noexcept {
+        if ((length - offset) >= literal_length) {
+            SizeT i = 1; // The first char is known.
+
+            while ((i < literal_length) && (content[offset + i] == literal[i])) {
+                ++i;
+            }
+
+            return ((i == literal_length) && indexedScalarEnd(content, (offset + literal_length), length));
+        }
+
+        return false;
+    }
+
+    // A scalar must run up to whitespace, a structural char, or the end of the content.
+    template <typename Char_T>
+    static bool indexedScalarEnd(const Char_T *content, const SizeT offset, const SizeT length) noexcept {
+        using NotationConstants = JSONUtils::NotationConstants_T<Char_T>;
+
+        if (offset < length) {
+            switch (content[offset]) {
+                case NotationConstants::SpaceChar:
+                case NotationConstants::LineControlChar:
+                case NotationConstants::TabControlChar:
+                case NotationConstants::CarriageControlChar:
+                case NotationConstants::CommaChar:
+                case NotationConstants::ECurlyChar:
+                case NotationConstants::ESquareChar: {
+                    return true;
+                }
+
+                default: {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    // An unescaped string leaves the stream empty and can borrow its text from the content.
+    template <bool Borrow_T, typename Stream_T, typename Char_T>
+    QENTEM_INLINE static String<Char_T> newString(const Stream_T &stream, const Char_T *str, SizeT len) {
+        if constexpr (Borrow_T) {
+            if (stream.IsEmpty()) {
+                String<Char_T> string;
+                string.Borrow(str, len);
+                return string;
+            }
+        }
+
+        return String<Char_T>{str, len};
+    }
+
+    template <bool Borrow_T, typename ValueT, typename Stream_T, typename Char_T>
+    QENTEM_INLINE static ValueT &newMember(typename ValueT::ObjectT &obj, const Stream_T &stream, const Char_T *str,
+                                           SizeT len, KeyTable<Char_T> *keys) {
+        if (keys != nullptr) {
+            SizeT          hash;
+            String<Char_T> key = keys->Key(str, len, hash);
+
+            return obj.Get(QUtility::Move(key), hash);
+        }
+
+        return obj[newString<Borrow_T>(stream, str, len)];
+    }
+
+    template <typename ValueT, typename Stream_T, typename Char_T, bool WithComments_T = false, bool Borrow_T = false>
+    static void parse(ValueT &value, Stream_T &stream, const Char_T *content, SizeT &offset, const SizeT length,
+                      KeyTable<Char_T> *keys) {
         using WhiteSpaceChars   = StringUtils::WhiteSpaceChars_T<Char_T>;
         using NotationConstants = JSONUtils::NotationConstants_T<Char_T>;
         using ObjectT           = typename ValueT::ObjectT;
@@ -187,9 +1038,11 @@ struct JSON {
             if (content[offset] == NotationConstants::SSquareChar) {
                 value = {ValueType::Array};
                 arr   = parent->GetArray();
-            } else {
+            } else if (content[offset] == NotationConstants::SCurlyChar) {
                 value = {ValueType::Object};
                 obj   = parent->GetObject();
+            } else {
+                return;
             }
 
             while ((++offset < length) && ((content[offset] == WhiteSpaceChars::SpaceChar) ||
@@ -214,21 +1067,22 @@ struct JSON {
                                 if (stream.IsNotEmpty()) {
                                     str = stream.First();
                                     len = stream.Length();
-                                    stream.Clear();
                                 }
 
                                 if (obj != nullptr) {
                                     if (obj_value == nullptr) {
                                         // Name
-                                        obj_value = &((*obj)[String<Char_T>{str, len}]);
+                                        obj_value = &(newMember<Borrow_T, ValueT>(*obj, stream, str, len, keys));
                                     } else {
-                                        *obj_value = ValueT{String<Char_T>{str, len}};
+                                        *obj_value = ValueT{newString<Borrow_T>(stream, str, len)};
                                         obj_value  = nullptr;
                                     }
                                 } else {
-                                    *arr += ValueT{String<Char_T>{str, len}};
+                                    *arr += ValueT{newString<Borrow_T>(stream, str, len)};
                                 }
 
+                                stream.Clear();
+
                                 expecting_value = false;
                             }
                         }
@@ -0,0 +1,247 @@
+/**
+ * @file JSONIndex.hpp
+ * @brief Structural index over JSON text, for JSON::Walk and parsing with JSONPaths.
+ *
+ * JSONIndex classifies the input 64 characters at a time using Platform::SIMD (or a plain
+ * loop when SIMD is disabled or characters are wider than a byte) and yields the offsets of
+ * every token a reader has to look at: structural characters outside strings, unescaped
+ * quotes, the first character of each scalar (number or literal), and backslashes or line
+ * controls inside strings.
+ *
+ * A string whose opening quote is directly followed by its closing quote in the index has
+ * nothing to unescape, so it can be taken as-is. Whitespace never shows up in the index, and
+ * a skipped value is stepped over by matching brackets on the index alone.
+ *
+ * The index is produced incrementally into a fixed buffer, so memory use does not grow
+ * with the size of the document.
+ *
+ * @copyright Copyright (c) 2026 Hani Ammar
+ * @license MIT
+ */
+
+#ifndef QENTEM_JSON_INDEX_H
+#define QENTEM_JSON_INDEX_H
+
+#include "Qentem/Platform.hpp"
+#include "Qentem/MemoryUtils.hpp"
+#include "Qentem/JSONUtils.hpp"
+
+namespace Qentem {
+
+template <typename Char_T>
+struct JSONIndex {
+    static constexpr SizeT32 BlockSize{64U};
+    static constexpr SizeT32 BlocksPerFill{16U};
+
+    JSONIndex(const Char_T *content, SizeT length) noexcept : content_{content}, length_{length} {
+    }
+
+    /**
+     * @brief Offset of the current token, or the content length once the input is exhausted.
+     */
+    QENTEM_INLINE SizeT Current() noexcept {
+        if (index_ == count_) {
+            fill();
+        }
+
+        return (index_ < count_) ? tokens_[index_] : length_;
+    }
+
+    QENTEM_INLINE void Next() noexcept {
+        ++index_;
+    }
+
+    /**
+     * @brief Drops every token before offset; used after a string has been read past the index.
+     */
+    QENTEM_INLINE void SkipTo(SizeT offset) noexcept {
+        while (Current() < offset) {
+            Next();
+        }
+    }
+
+  private:
+    using NotationConstants = JSONUtils::NotationConstants_T<Char_T>;
+
+    void fill() noexcept {
+        SizeT32 blocks{0};
+
+        index_ = 0;
+        count_ = 0;
+
+        // Keep going past BlocksPerFill only while nothing was found (long strings or whitespace).
+        while ((offset_ < length_) && ((blocks < BlocksPerFill) || (count_ == 0))) {
+            SizeT64 bits;
+
+            if ((length_ - offset_) >= BlockSize) {
+                bits = classify(content_ + offset_);
+            } else {
+                Char_T      tail[BlockSize];
+                const SizeT rest = (length_ - offset_);
+                SizeT32     i    = SizeT32(rest);
+
+                MemoryUtils::CopyTo(&(tail[0]), (content_ + offset_), rest);
+
+                while (i < BlockSize) {
+                    tail[i] = NotationConstants::SpaceChar;
+                    ++i;
+                }
+
+                bits = classify(&(tail[0]));
+            }
+
+            while (bits != 0) {
+                tokens_[count_] = (offset_ + Platform::FindFirstBit(bits));
+                ++count_;
+                bits &= (bits - SizeT64{1});
+            }
+
+            offset_ += BlockSize;
+            ++blocks;
+        }
+    }
+
+    SizeT64 classify(const Char_T *block) noexcept {
+        SizeT64 quote{0};
+        SizeT64 back_slash{0};
+        SizeT64 structural{0};
+        SizeT64 white_space{0};
+        SizeT64 control{0};
+
+        if constexpr (QentemConfig::IsSIMDEnabled && (sizeof(Char_T) == 1U)) {
+            using SIMD  = Platform::SIMD;
+            using VAR_T = typename SIMD::VAR_T;
+
+            const VAR_T m_quote      = SIMD::SetToOne8Bit(NotationConstants::QuoteChar);
+            const VAR_T m_back_slash = SIMD::SetToOne8Bit(NotationConstants::BSlashChar);
+            const VAR_T m_s_curly    = SIMD::SetToOne8Bit(NotationConstants::SCurlyChar);
+            const VAR_T m_e_curly    = SIMD::SetToOne8Bit(NotationConstants::ECurlyChar);
+            const VAR_T m_s_square   = SIMD::SetToOne8Bit(NotationConstants::SSquareChar);
+            const VAR_T m_e_square   = SIMD::SetToOne8Bit(NotationConstants::ESquareChar);
+            const VAR_T m_colon      = SIMD::SetToOne8Bit(NotationConstants::ColonChar);
+            const VAR_T m_comma      = SIMD::SetToOne8Bit(NotationConstants::CommaChar);
+            const VAR_T m_space      = SIMD::SetToOne8Bit(NotationConstants::SpaceChar);
+            const VAR_T m_line       = SIMD::SetToOne8Bit(NotationConstants::LineControlChar);
+            const VAR_T m_tab        = SIMD::SetToOne8Bit(NotationConstants::TabControlChar);
+            const VAR_T m_carriage   = SIMD::SetToOne8Bit(NotationConstants::CarriageControlChar);
+
+            SizeT32 offset{0};
+
+            while (offset < BlockSize) {
+                const VAR_T value = SIMD::Load(reinterpret_cast<const VAR_T *>(block + offset));
+
+                quote |= (SizeT64{SIMD::Compare8Bit(value, m_quote)} << offset);
+                back_slash |= (SizeT64{SIMD::Compare8Bit(value, m_back_slash)} << offset);
+                structural |= (SizeT64{SIMD::Compare8Bit(value, m_s_curly) | SIMD::Compare8Bit(value, m_e_curly) |
+                                       SIMD::Compare8Bit(value, m_s_square) | SIMD::Compare8Bit(value, m_e_square) |
+                                       SIMD::Compare8Bit(value, m_colon) | SIMD::Compare8Bit(value, m_comma)}
+                               << offset);
+                control |= (SizeT64{SIMD::Compare8Bit(value, m_line) | SIMD::Compare8Bit(value, m_tab) |
+                                    SIMD::Compare8Bit(value, m_carriage)}
+                            << offset);
+                white_space |= (SizeT64{SIMD::Compare8Bit(value, m_space)} << offset);
+
+                offset += SIMD::Size;
+            }
+        } else {
+            SizeT32 offset{0};
+
+            while (offset < BlockSize) {
+                const SizeT64 bit = (SizeT64{1} << offset);
+
+                switch (block[offset]) {
+                    case NotationConstants::QuoteChar: {
+                        quote |= bit;
+                        break;
+                    }
+
+                    case NotationConstants::BSlashChar: {
+                        back_slash |= bit;
+                        break;
+                    }
+
+                    case NotationConstants::SCurlyChar:
+                    case NotationConstants::ECurlyChar:
+                    case NotationConstants::SSquareChar:
+                    case NotationConstants::ESquareChar:
+                    case NotationConstants::ColonChar:
+                    case NotationConstants::CommaChar: {
+                        structural |= bit;
+                        break;
+                    }
+
+                    case NotationConstants::LineControlChar:
+                    case NotationConstants::TabControlChar:
+                    case NotationConstants::CarriageControlChar: {
+                        control |= bit;
+                        break;
+                    }
+
+                    case NotationConstants::SpaceChar: {
+                        white_space |= bit;
+                        break;
+                    }
+
+                    default: {
+                    }
+                }
+
+                ++offset;
+            }
+        }
+
+        white_space |= control;
+
+        // Escaped characters: each unescaped backslash escapes the one after it. Backslashes are
+        // rare enough that walking them one by one beats a branch-free formulation here.
+        SizeT64 escaped = escape_carry_;
+        SizeT64 slashes = (back_slash & ~escaped);
+        escape_carry_   = 0;
+
+        while (slashes != 0) {
+            const SizeT64 bit  = (slashes & (~slashes + SizeT64{1}));
+            const SizeT64 next = (bit << 1U);
+
+            if (next == 0) {
+                escape_carry_ = 1;
+            }
+
+            escaped |= next;
+            slashes &= ~(bit | next);
+        }
+
+        quote &= ~escaped;
+
+        // Prefix XOR over the quotes: set from an opening quote up to, not including, its closing quote.
+        SizeT64 in_string = quote;
+        in_string ^= (in_string << 1U);
+        in_string ^= (in_string << 2U);
+        in_string ^= (in_string << 4U);
+        in_string ^= (in_string << 8U);
+        in_string ^= (in_string << 16U);
+        in_string ^= (in_string << 32U);
+        in_string ^= string_carry_;
+        string_carry_ = (SizeT64{0} - (in_string >> 63U));
+
+        const SizeT64 special = ((back_slash | control) & in_string & ~quote);
+        const SizeT64 scalar  = (~(white_space | structural | quote) & ~in_string);
+        const SizeT64 starts  = (scalar & ~((scalar << 1U) | scalar_carry_));
+        scalar_carry_         = (scalar >> 63U);
+
+        return ((structural & ~in_string) | quote | special | starts);
+    }
+
+    SizeT         tokens_[BlocksPerFill * BlockSize];
+    const Char_T *content_;
+    SizeT         length_;
+    SizeT         offset_{0};
+    SizeT         index_{0};
+    SizeT         count_{0};
+    SizeT64       escape_carry_{0};
+    SizeT64       string_carry_{0};
+    SizeT64       scalar_carry_{0};
+};
+
+} // namespace Qentem
+
+#endif
@@ -0,0 +1,664 @@
+/**
+ * @file JSONPatch.hpp
+ * @brief Structural diff of two Value trees as a JSON Patch, and applying one.
+ *
+ * Diff() compares two documents and returns the changes between them as a JSON Patch
+ * (RFC 6902): an array of {"op", "path", "value"} objects with JSON Pointer (RFC 6901)
+ * paths. For a small change to a large document, sending the patch instead of the whole
+ * document saves both the bandwidth and the client's re-parse.
+ *
+ * Objects are compared key by key. Members are matched in the order the objects keep
+ * them, so keys at the same position cost a string compare instead of a lookup. Arrays
+ * are compared item by item, then extended or truncated at the end. Subtrees that are
+ * the same node, or that share one container (see Value::Share()), are skipped without
+ * being visited. Two shared values with the same structural hash (see Value::Hash()) are
+ * skipped once EqualsNumerically() confirms them; the hash only rules a match out. Numbers
+ * compare by value, as RFC 6902 says, so 1 and 1.0 are the same; other differences of type
+ * or scalar become "replace".
+ *
+ * Apply() runs a patch against a document. It supports all six operations: add, remove,
+ * replace, move, copy and test. It stops at the first operation that fails and returns
+ * false. Operations before the failing one stay applied; for all-or-nothing, apply to a
+ * copy. Array positions count the items that Stringify() writes; apply to arrays without
+ * removed items (see Value::Compress()). A value that points to another one (see
+ * Value::AddPointerToValue()) can be replaced or removed, but paths into it fail.
+ *
+ * @copyright Copyright (c) 2026 Hani Ammar
+ * @license MIT
+ */
+
+#ifndef QENTEM_JSON_PATCH_H
+#define QENTEM_JSON_PATCH_H
+
+#include "Qentem/Value.hpp"
+
+namespace Qentem {
+
+struct JSONPatch {
+    template <typename Char_T>
+    static Value<Char_T> Diff(const Value<Char_T> &from, const Value<Char_T> &to) {
+        Value<Char_T>        patch{ValueType::Array};
+        StringStream<Char_T> path;
+
+        diff(from, to, path, patch);
+
+        return patch;
+    }
+
+    /**
+     * @brief Applies patch to document.
+     *
+     * @return false if the patch is malformed or an operation cannot be applied.
+     */
+    template <typename Char_T>
+    static bool Apply(Value<Char_T> &document, const Value<Char_T> &patch) {
+        using ValueT      = Value<Char_T>;
+        using Strings     = Strings_T<Char_T>;
+        using StringViewT = StringView<Char_T>;
+
+        const typename ValueT::ArrayT *operations = patch.GetArray();
+
+        if (operations == nullptr) {
+            return false;
+        }
+
+        for (const ValueT &operation : *operations) {
+            if (operation.IsUndefined()) {
+                continue;
+            }
+
+            const ValueT *op_value   = operation.GetValue(StringViewT{Strings::Op, Strings::OpLength});
+            const ValueT *path_value = operation.GetValue(StringViewT{Strings::Path, Strings::PathLength});
+
+            if ((op_value == nullptr) || (path_value == nullptr) || !(op_value->IsString()) ||
+                !(path_value->IsString())) {
+                return false;
+            }
+
+            const StringViewT op    = op_value->GetStringView();
+            const StringViewT path  = path_value->GetStringView();
+            const ValueT     *value = operation.GetValue(StringViewT{Strings::ValueKey, Strings::ValueKeyLength});
+            bool              done  = false;
+
+            if (op.IsEqual(Strings::Add, Strings::AddLength)) {
+                done = ((value != nullptr) && add(document, path, ValueT{*value}));
+            } else if (op.IsEqual(Strings::Remove, Strings::RemoveLength)) {
+                done = remove<Char_T>(document, path, nullptr);
+            } else if (op.IsEqual(Strings::Replace, Strings::ReplaceLength)) {
+                ValueT *target = find(document, path);
+
+                if ((target != nullptr) && (value != nullptr)) {
+                    *target = *value;
+                    done    = true;
+                }
+            } else if (op.IsEqual(Strings::Test, Strings::TestLength)) {
+                const ValueT *target = find(document, path);
+                done                 = ((target != nullptr) && (value != nullptr) && target->EqualsNumerically(*value));
+            } else {
+                const ValueT *from_value = operation.GetValue(StringViewT{Strings::From, Strings::FromLength});
+
+                if ((from_value != nullptr) && from_value->IsString()) {
+                    const StringViewT from = from_value->GetStringView();
+
+                    if (op.IsEqual(Strings::Move, Strings::MoveLength)) {
+                        ValueT taken;
+
+                        if (from == path) {
+                            done = (find(document, from) != nullptr);
+                        } else if (!isPrefix(from, path) && remove(document, from, &taken)) {
+                            // A value cannot be moved into one of its own children.
+                            done = add(document, path, QUtility::Move(taken));
+                        }
+                    } else if (op.IsEqual(Strings::Copy, Strings::CopyLength)) {
+                        const ValueT *source = find(document, from);
+                        done                 = ((source != nullptr) && add(document, path, ValueT{*source}));
+                    }
+                }
+            }
+
+            if (!done) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+  private:
+    template <typename Char_T>
+    struct Strings_T {
+        static constexpr Char_T Op[]       = {'o', 'p'};
+        static constexpr Char_T Path[]     = {'p', 'a', 't', 'h'};
+        static constexpr Char_T ValueKey[] = {'v', 'a', 'l', 'u', 'e'};
+        static constexpr Char_T From[]     = {'f', 'r', 'o', 'm'};
+        static constexpr Char_T Add[]      = {'a', 'd', 'd'};
+        static constexpr Char_T Remove[]   = {'r', 'e', 'm', 'o', 'v', 'e'};
+        static constexpr Char_T Replace[]  = {'r', 'e', 'p', 'l', 'a', 'c', 'e'};
+        static constexpr Char_T Move[]     = {'m', 'o', 'v', 'e'};
+        static constexpr Char_T Copy[]     = {'c', 'o', 'p', 'y'};
+        static constexpr Char_T Test[]     = {'t', 'e', 's', 't'};
+
+        static constexpr SizeT OpLength{2};
+        static constexpr SizeT PathLength{4};
+        static constexpr SizeT ValueKeyLength{5};
+        static constexpr SizeT FromLength{4};
+        static constexpr SizeT AddLength{3};
+        static constexpr SizeT RemoveLength{6};
+        static constexpr SizeT ReplaceLength{7};
+        static constexpr SizeT MoveLength{4};
+        static constexpr SizeT CopyLength{4};
+        static constexpr SizeT TestLength{4};
+
+        static constexpr Char_T Separator{'/'};
+        static constexpr Char_T Tilde{'~'};
+        static constexpr Char_T EscapedTilde{'0'};
+        static constexpr Char_T EscapedSlash{'1'};
+        static constexpr Char_T EndOfArray{'-'};
+    };
+
+    template <typename Char_T>
+    static void diff(const Value<Char_T> &from, const Value<Char_T> &to, StringStream<Char_T> &path,
+                     Value<Char_T> &patch) {
+        if (isSame(from, to)) {
+            return;
+        }
+
+        // Shared values keep their hash. Different hashes go straight to the walk below; equal ones are
+        // confirmed before the subtree is skipped, so a collision cannot hide a change.
+        if (from.IsShared() && to.IsShared() && (from.Hash() == to.Hash()) && from.EqualsNumerically(to)) {
+            return;
+        }
+
+        if (from.IsObject() && to.IsObject()) {
+            diffObjects(*(from.GetObject()), *(to.GetObject()), path, patch);
+        } else if (from.IsArray() && to.IsArray()) {
+            diffArrays(*(from.GetArray()), *(to.GetArray()), path, patch);
+        } else if (!(from.EqualsNumerically(to))) {
+            addOperation(patch, Strings_T<Char_T>::Replace, Strings_T<Char_T>::ReplaceLength, path, &to);
+        }
+    }
+
+    template <typename Char_T>
+    static void diffObjects(const typename Value<Char_T>::ObjectT &from, const typename Value<Char_T>::ObjectT &to,
+                            StringStream<Char_T> &path, Value<Char_T> &patch) {
+        using ValueT  = Value<Char_T>;
+        using VItem   = typename ValueT::VItem;
+        using Strings = Strings_T<Char_T>;
+
+        const VItem *from_item = from.First();
+        const VItem *from_end  = (from_item + from.Size());
+        const VItem *to_item   = to.First();
+        const VItem *to_end    = (to_item + to.Size());
+        const SizeT  length    = path.Length();
+        SizeT        matched{0};
+        SizeT        to_count{0};
+        bool         in_order = true;
+
+        // Removed and changed members, in the order of from.
+        while (from_item != from_end) {
+            if (!(from_item->Value.IsUndefined())) {
+                while ((to_item != to_end) && to_item->Value.IsUndefined()) {
+                    ++to_item;
+                }
+
+                const ValueT *to_value = nullptr;
+
+                if (in_order && (to_item != to_end) && (to_item->Key == from_item->Key)) {
+                    to_value = &(to_item->Value);
+                    ++to_item;
+                } else {
+                    in_order = false;
+                    to_value = to.GetValue(from_item->Key.First(), from_item->Key.Length());
+
+                    if ((to_value != nullptr) && to_value->IsUndefined()) {
+                        to_value = nullptr;
+                    }
+                }
+
+                appendKey(path, from_item->Key.First(), from_item->Key.Length());
+
+                if (to_value != nullptr) {
+                    ++matched;
+                    diff(from_item->Value, *to_value, path, patch);
+                } else {
+                    addOperation<Char_T>(patch, Strings::Remove, Strings::RemoveLength, path, nullptr);
+                }
+
+                path.SetLength(length);
+            }
+
+            ++from_item;
+        }
+
+        to_item = to.First();
+
+        while (to_item != to_end) {
+            to_count += SizeT{!(to_item->Value.IsUndefined())};
+            ++to_item;
+        }
+
+        if (matched == to_count) {
+            return;
+        }
+
+        // Added members, in the order of to.
+        to_item = to.First();
+
+        while (to_item != to_end) {
+            if (!(to_item->Value.IsUndefined())) {
+                const ValueT *from_value = from.GetValue(to_item->Key.First(), to_item->Key.Length());
+
+                if ((from_value == nullptr) || from_value->IsUndefined()) {
+                    appendKey(path, to_item->Key.First(), to_item->Key.Length());
+                    addOperation(patch, Strings::Add, Strings::AddLength, path, &(to_item->Value));
+                    path.SetLength(length);
+                }
+            }
+
+            ++to_item;
+        }
+    }
+
+    template <typename Char_T>
+    static void diffArrays(const typename Value<Char_T>::ArrayT &from, const typename Value<Char_T>::ArrayT &to,
+                           StringStream<Char_T> &path, Value<Char_T> &patch) {
+        using ValueT  = Value<Char_T>;
+        using Strings = Strings_T<Char_T>;
+
+        const ValueT *from_item = from.First();
+        const ValueT *from_end  = from.End();
+        const ValueT *to_item   = to.First();
+        const ValueT *to_end    = to.End();
+        const SizeT   length    = path.Length();
+        SizeT         index{0};
+
+        while (true) {
+            while ((from_item != from_end) && from_item->IsUndefined()) {
+                ++from_item;
+            }
+
+            while ((to_item != to_end) && to_item->IsUndefined()) {
+                ++to_item;
+            }
+
+            if ((from_item == from_end) || (to_item == to_end)) {
+                break;
+            }
+
+            appendIndex(path, index);
+            diff(*from_item, *to_item, path, patch);
+            path.SetLength(length);
+
+            ++from_item;
+            ++to_item;
+            ++index;
+        }
+
+        // Extra items in to are appended.
+        while (to_item != to_end) {
+            if (!(to_item->IsUndefined())) {
+                appendIndex(path, index);
+                addOperation(patch, Strings::Add, Strings::AddLength, path, to_item);
+                path.SetLength(length);
+                ++index;
+            }
+
+            ++to_item;
+        }
+
+        // Extra items in from are removed from the last, so earlier positions stay valid.
+        SizeT last = index;
+
+        while (from_item != from_end) {
+            last += SizeT{!(from_item->IsUndefined())};
+            ++from_item;
+        }
+
+        while (last > index) {
+            --last;
+            appendIndex(path, last);
+            addOperation<Char_T>(patch, Strings::Remove, Strings::RemoveLength, path, nullptr);
+            path.SetLength(length);
+        }
+    }
+
+    template <typename Char_T>
+    static void addOperation(Value<Char_T> &patch, const Char_T *op, SizeT op_length, const StringStream<Char_T> &path,
+                             const Value<Char_T> *value) {
+        using ValueT      = Value<Char_T>;
+        using Strings     = Strings_T<Char_T>;
+        using StringViewT = StringView<Char_T>;
+
+        ValueT operation{ValueType::Object, SizeT{3}};
+
+        operation[StringViewT{Strings::Op, Strings::OpLength}]     = StringViewT{op, op_length};
+        operation[StringViewT{Strings::Path, Strings::PathLength}] = StringViewT{path.First(), path.Length()};
+
+        if (value != nullptr) {
+            operation[StringViewT{Strings::ValueKey, Strings::ValueKeyLength}] = *value;
+        }
+
+        patch += QUtility::Move(operation);
+    }
+
+    // "/" and the key, with "~" written as "~0" and "/" as "~1".
+    template <typename Char_T>
+    static void appendKey(StringStream<Char_T> &path, const Char_T *key, SizeT length) {
+        using Strings = Strings_T<Char_T>;
+
+        SizeT offset{0};
+        SizeT start{0};
+
+        path.Write(Strings::Separator);
+
+        while (offset < length) {
+            const Char_T ch = key[offset];
+
+            if ((ch == Strings::Tilde) || (ch == Strings::Separator)) {
+                path.Write((key + start), (offset - start));
+                path.Write(Strings::Tilde);
+                path.Write((ch == Strings::Tilde) ? Strings::EscapedTilde : Strings::EscapedSlash);
+                start = (offset + SizeT{1});
+            }
+
+            ++offset;
+        }
+
+        path.Write((key + start), (length - start));
+    }
+
+    template <typename Char_T>
+    QENTEM_INLINE static void appendIndex(StringStream<Char_T> &path, SizeT index) {
+        path.Write(Strings_T<Char_T>::Separator);
+        Digit::NumberToString(path, index);
+    }
+
+    // The same node, or two values sharing one container.
+    template <typename Char_T>
+    static bool isSame(const Value<Char_T> &left, const Value<Char_T> &right) noexcept {
+        if (&left == &right) {
+            return true;
+        }
+
+        if (left.IsObject()) {
+            return (left.GetObject() == right.GetObject());
+        }
+
+        if (left.IsArray()) {
+            return (left.GetArray() == right.GetArray());
+        }
+
+        if (left.IsString()) {
+            return (left.GetString() == right.GetString());
+        }
+
+        return false;
+    }
+
+    // Whether pointer equals prefix or lies under it.
+    template <typename Char_T>
+    static bool isPrefix(const StringView<Char_T> &prefix, const StringView<Char_T> &pointer) noexcept {
+        return ((prefix.Length() <= pointer.Length()) &&
+                StringUtils::IsEqual(prefix.First(), pointer.First(), prefix.Length()) &&
+                ((prefix.Length() == pointer.Length()) ||
+                 (pointer.First()[prefix.Length()] == Strings_T<Char_T>::Separator)));
+    }
+
+    /*
+     * Splits pointer into the parent's path and the last reference token, unescaped into
+     * token. Returns false for a pointer that does not start with "/", or whose last token
+     * is not escaped as RFC 6901 has it.
+     */
+    template <typename Char_T>
+    static bool splitLast(const StringView<Char_T> &pointer, StringView<Char_T> &parent, StringStream<Char_T> &token) {
+        using Strings = Strings_T<Char_T>;
+
+        const Char_T *str    = pointer.First();
+        SizeT         offset = pointer.Length();
+
+        if ((offset == 0) || (str[0] != Strings::Separator)) {
+            return false;
+        }
+
+        --offset;
+
+        while (str[offset] != Strings::Separator) {
+            --offset;
+        }
+
+        parent = StringView<Char_T>{str, offset};
+
+        return unescape(token, (str + offset + SizeT{1}), (pointer.Length() - offset - SizeT{1}));
+    }
+
+    // "~0" is "~" and "~1" is "/"; false for any other "~", including one at the end.
+    template <typename Char_T>
+    static bool unescape(StringStream<Char_T> &token, const Char_T *str, SizeT length) {
+        using Strings = Strings_T<Char_T>;
+
+        SizeT offset{0};
+
+        token.Clear();
+
+        while (offset < length) {
+            if (str[offset] == Strings::Tilde) {
+                ++offset;
+
+                if (offset == length) {
+                    return false;
+                }
+
+                if (str[offset] == Strings::EscapedSlash) {
+                    token.Write(Strings::Separator);
+                } else if (str[offset] == Strings::EscapedTilde) {
+                    token.Write(Strings::Tilde);
+                } else {
+                    return false;
+                }
+            } else {
+                token.Write(str[offset]);
+            }
+
+            ++offset;
+        }
+
+        return true;
+    }
+
+    // A decimal array position without leading zeros.
+    template <typename Char_T>
+    static bool toIndex(const StringStream<Char_T> &token, SizeT &index) noexcept {
+        const SizeT length = token.Length();
+
+        if ((length == 0) || ((length > SizeT{1}) && (token.First()[0] == Char_T{'0'}))) {
+            return false;
+        }
+
+        index = 0;
+
+        for (const Char_T ch : token) {
+            if ((ch < Char_T{'0'}) || (ch > Char_T{'9'})) {
+                return false;
+            }
+
+            index = ((index * SizeT{10}) + SizeT(ch - Char_T{'0'}));
+        }
+
+        return true;
+    }
+
+    // Follows pointer from root; nullptr if any part of it is missing. A value that points to
+    // another one (see Value::AddPointerToValue()) is read-only, so the walk does not enter it.
+    template <typename Char_T>
+    static Value<Char_T> *find(Value<Char_T> &root, const StringView<Char_T> &pointer) {
+        using ValueT  = Value<Char_T>;
+        using Strings = Strings_T<Char_T>;
+
+        StringStream<Char_T> token;
+        ValueT              *value  = &root;
+        const Char_T        *str    = pointer.First();
+        const SizeT          length = pointer.Length();
+        SizeT                offset{0};
+
+        if ((length != 0) && (str[0] != Strings::Separator)) {
+            return nullptr;
+        }
+
+        while ((value != nullptr) && (offset < length)) {
+            ++offset; // /
+            const SizeT start = offset;
+
+            while ((offset < length) && (str[offset] != Strings::Separator)) {
+                ++offset;
+            }
+
+            if (!unescape(token, (str + start), (offset - start))) {
+                return nullptr;
+            }
+
+            if ((value->Type() == ValueType::ValuePtr) && !(value->IsShared())) {
+                return nullptr;
+            }
+
+            if (value->IsArray()) {
+                SizeT index;
+
+                if (!toIndex(token, index)) {
+                    return nullptr;
+                }
+
+                value = value->GetValueAt(index);
+            } else {
+                value = value->GetValue(token.First(), token.Length());
+            }
+        }
+
+        return value;
+    }
+
+    template <typename Char_T>
+    static bool add(Value<Char_T> &document, const StringView<Char_T> &pointer, Value<Char_T> &&value) {
+        using ValueT = Value<Char_T>;
+
+        StringView<Char_T>   parent_path;
+        StringStream<Char_T> token;
+
+        if (pointer.Length() == 0) {
+            document = QUtility::Move(value);
+            return true;
+        }
+
+        if (!splitLast(pointer, parent_path, token)) {
+            return false;
+        }
+
+        ValueT *parent = find(document, parent_path);
+
+        if (parent == nullptr) {
+            return false;
+        }
+
+        typename ValueT::ObjectT *object = parent->GetObject();
+
+        if (object != nullptr) {
+            object->Get(token.First(), token.Length()) = QUtility::Move(value);
+            return true;
+        }
+
+        typename ValueT::ArrayT *items = parent->GetArray();
+
+        if (items != nullptr) {
+            typename ValueT::ArrayT &array = *items;
+            SizeT                    index;
+
+            if ((token.Length() == SizeT{1}) && (token.First()[0] == Strings_T<Char_T>::EndOfArray)) {
+                index = array.Size();
+            } else if (!toIndex(token, index) || (index > array.Size())) {
+                return false;
+            }
+
+            array += ValueT{};
+
+            ValueT *storage = array.Storage();
+            SizeT   last    = (array.Size() - SizeT{1});
+
+            while (last > index) {
+                storage[last] = QUtility::Move(storage[last - SizeT{1}]);
+                --last;
+            }
+
+            storage[index] = QUtility::Move(value);
+            return true;
+        }
+
+        return false;
+    }
+
+    // Removes the value at pointer; moves it to taken when given.
+    template <typename Char_T>
+    static bool remove(Value<Char_T> &document, const StringView<Char_T> &pointer, Value<Char_T> *taken) {
+        using ValueT = Value<Char_T>;
+
+        StringView<Char_T>   parent_path;
+        StringStream<Char_T> token;
+
+        if (!splitLast(pointer, parent_path, token)) {
+            return false;
+        }
+
+        ValueT *parent = find(document, parent_path);
+
+        if (parent == nullptr) {
+            return false;
+        }
+
+        typename ValueT::ObjectT *object = parent->GetObject();
+
+        if (object != nullptr) {
+            ValueT *value = object->GetValue(token.First(), token.Length());
+
+            if ((value == nullptr) || value->IsUndefined()) {
+                return false;
+            }
+
+            if (taken != nullptr) {
+                *taken = QUtility::Move(*value);
+            }
+
+            object->Remove(token.First(), token.Length());
+            return true;
+        }
+
+        typename ValueT::ArrayT *items = parent->GetArray();
+
+        if (items != nullptr) {
+            typename ValueT::ArrayT &array = *items;
+            SizeT                    index;
+
+            if (!toIndex(token, index) || (index >= array.Size())) {
+                return false;
+            }
+
+            ValueT     *storage = array.Storage();
+            const SizeT last    = (array.Size() - SizeT{1});
+
+            if (taken != nullptr) {
+                *taken = QUtility::Move(storage[index]);
+            }
+
+            while (index < last) {
+                storage[index] = QUtility::Move(storage[index + SizeT{1}]);
+                ++index;
+            }
+
+            array.Drop(SizeT{1});
+            return true;
+        }
+
+        return false;
+    }
+};
+
+} // namespace Qentem
+
+#endif
@@ -0,0 +1,264 @@
+/**
+ * @file JSONPaths.hpp
+ * @brief Compiled set of JSON paths for parsing only the parts of a document that are used.
+ *
+ * Paths are written as keys separated by dots, with array positions in brackets:
+ * `meta.id`, `items[*].price`, `rows[0]`. `[*]` matches every item of an array.
+ * All paths are merged into one tree, so a document is matched against the whole
+ * set in a single pass (see JSON::Parse with JSONPaths).
+ *
+ * @copyright Copyright (c) 2026 Hani Ammar
+ * @license MIT
+ */
+
+#ifndef QENTEM_JSON_PATHS_H
+#define QENTEM_JSON_PATHS_H
+
+#include "Qentem/Array.hpp"
+#include "Qentem/String.hpp"
+#include "Qentem/Digit.hpp"
+
+namespace Qentem {
+
+enum struct JSONPathKind : SizeT8 { Key, Index, AnyIndex };
+
+/**
+ * @brief One step of the path tree.
+ *
+ * IsEnd marks a step that ends a path: the whole value under it is wanted, whatever
+ * else may be listed below it.
+ */
+template <typename Char_T>
+struct JSONPathNode {
+    String<Char_T>      Key{};
+    Array<JSONPathNode> Children{};
+    SizeT               Index{0};
+    JSONPathKind        Kind{JSONPathKind::Key};
+    bool                IsEnd{false};
+
+    const JSONPathNode *FindKey(const Char_T *key, SizeT length) const noexcept {
+        for (const JSONPathNode &child : Children) {
+            if ((child.Kind == JSONPathKind::Key) && child.Key.IsEqual(key, length)) {
+                return &child;
+            }
+        }
+
+        return nullptr;
+    }
+
+    // An exact position also holds every path listed under [*] (see JSONPaths::Add()), so
+    // it is all that is needed when present.
+    const JSONPathNode *FindIndex(SizeT index) const noexcept {
+        const JSONPathNode *any = nullptr;
+
+        for (const JSONPathNode &child : Children) {
+            if (child.Kind == JSONPathKind::Index) {
+                if (child.Index == index) {
+                    return &child;
+                }
+            } else if (child.Kind == JSONPathKind::AnyIndex) {
+                any = &child;
+            }
+        }
+
+        return any;
+    }
+};
+
+template <typename Char_T>
+struct JSONPaths {
+    using NodeT = JSONPathNode<Char_T>;
+
+    /**
+     * @brief Adds a path to the set.
+     *
+     * @return false if the path is malformed; the set is left as it was.
+     */
+    bool Add(const Char_T *path, SizeT length) {
+        if (!isValid(path, length)) {
+            return false;
+        }
+
+        add(root_, path, 0, length);
+
+        return true;
+    }
+
+    QENTEM_INLINE bool Add(const Char_T *path) {
+        return Add(path, StringUtils::Count(path));
+    }
+
+    QENTEM_INLINE const NodeT &Root() const noexcept {
+        return root_;
+    }
+
+    QENTEM_INLINE bool IsEmpty() const noexcept {
+        return root_.Children.IsEmpty();
+    }
+
+  private:
+    static constexpr Char_T DotChar{'.'};
+    static constexpr Char_T BracketStart{'['};
+    static constexpr Char_T BracketEnd{']'};
+    static constexpr Char_T AnyChar{'*'};
+
+    // Adds the steps of a valid path from offset on, under node.
+    static void add(NodeT &node, const Char_T *path, SizeT offset, const SizeT length) {
+        if (offset == length) {
+            node.IsEnd = true;
+            return;
+        }
+
+        JSONPathKind kind  = JSONPathKind::Key;
+        SizeT        index = 0;
+        SizeT        start = offset;
+
+        if (path[offset] == BracketStart) {
+            ++offset;
+            start = offset;
+
+            while (path[offset] != BracketEnd) {
+                ++offset;
+            }
+
+            if (path[start] == AnyChar) {
+                kind = JSONPathKind::AnyIndex;
+            } else {
+                kind = JSONPathKind::Index;
+                Digit::FastStringToNumber(index, (path + start), (offset - start));
+            }
+
+            ++offset; // ]
+        } else {
+            while ((offset < length) && (path[offset] != DotChar) && (path[offset] != BracketStart)) {
+                ++offset;
+            }
+        }
+
+        NodeT &next = child(node, kind, (path + start), (offset - start), index);
+
+        if ((offset < length) && (path[offset] == DotChar)) {
+            ++offset;
+        }
+
+        if (kind == JSONPathKind::AnyIndex) {
+            // Exact positions take the rest too, as the parser follows only one of the two.
+            for (NodeT &item : node.Children) {
+                if (item.Kind == JSONPathKind::Index) {
+                    add(item, path, offset, length);
+                }
+            }
+        }
+
+        add(next, path, offset, length);
+    }
+
+    static NodeT &child(NodeT &node, JSONPathKind kind, const Char_T *key, SizeT length, SizeT index) {
+        const NodeT *any = nullptr;
+
+        for (NodeT &item : node.Children) {
+            if ((item.Kind == kind) && ((kind != JSONPathKind::Key) || item.Key.IsEqual(key, length)) &&
+                ((kind != JSONPathKind::Index) || (item.Index == index))) {
+                return item;
+            }
+
+            if (item.Kind == JSONPathKind::AnyIndex) {
+                any = &item;
+            }
+        }
+
+        // A new exact position starts with everything already listed under [*].
+        NodeT item{};
+
+        if ((kind == JSONPathKind::Index) && (any != nullptr)) {
+            item = *any;
+        }
+
+        item.Kind  = kind;
+        item.Index = index;
+
+        if (kind == JSONPathKind::Key) {
+            item.Key = String<Char_T>{key, length};
+        }
+
+        return node.Children.Insert(QUtility::Move(item));
+    }
+
+    // Keys may not be empty; brackets hold '*' or an index SizeT can hold; a dot must be followed by a key.
+    static bool isValid(const Char_T *path, SizeT length) noexcept {
+        SizeT offset = 0;
+
+        if (length == 0) {
+            return false;
+        }
+
+        while (offset < length) {
+            if (path[offset] == BracketStart) {
+                ++offset;
+
+                if ((offset < length) && (path[offset] == AnyChar)) {
+                    ++offset;
+                } else {
+                    const SizeT start = offset;
+                    SizeT       index = 0;
+
+                    while ((offset < length) && (path[offset] >= Char_T{'0'}) && (path[offset] <= Char_T{'9'})) {
+                        const SizeT digit = SizeT(path[offset] - Char_T{'0'});
+
+                        // An index that SizeT cannot hold.
+                        if (index > ((SizeT(~SizeT{0}) - digit) / SizeT{10})) {
+                            return false;
+                        }
+
+                        index = ((index * SizeT{10}) + digit);
+                        ++offset;
+                    }
+
+                    if (offset == start) {
+                        return false;
+                    }
+                }
+
+                if ((offset == length) || (path[offset] != BracketEnd)) {
+                    return false;
+                }
+
+                ++offset;
+
+                if ((offset < length) && (path[offset] != DotChar) && (path[offset] != BracketStart)) {
+                    return false;
+                }
+            } else {
+                const SizeT start = offset;
+
+                while ((offset < length) && (path[offset] != DotChar) && (path[offset] != BracketStart)) {
+                    if (path[offset] == BracketEnd) {
+                        return false;
+                    }
+
+                    ++offset;
+                }
+
+                if (offset == start) {
+                    return false;
+                }
+            }
+
+            if ((offset < length) && (path[offset] == DotChar)) {
+                ++offset;
+
+                if ((offset == length) || (path[offset] == BracketStart)) {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    NodeT root_{};
+};
+
+} // namespace Qentem
+
+#endif
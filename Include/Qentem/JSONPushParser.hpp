@@ -0,0 +1,522 @@
+/**
+ * @file JSONPushParser.hpp
+ * @brief Resumable JSON parser that takes its input in chunks.
+ *
+ * JSONPushParser builds the same Value as JSON::Parse, but the document may arrive in
+ * any number of pieces, split anywhere: inside a string, an escape, a number or a literal.
+ * Each call to Feed() consumes what it is given and remembers where it stopped; only the
+ * token that straddles a chunk boundary is buffered, never the whole document.
+ *
+ * Like JSON::Parse, the parser is iterative and keeps the open containers on an explicit
+ * tree stack; here the stack is a member, so it, not the call stack, carries the state
+ * from one chunk to the next. Strings end where JSON::Parse ends them: escapes are stepped
+ * over by JSONUtils::EscapeLength() and decoded by JSONUtils::UnEscape().
+ *
+ * @code
+ * JSONPushParser<char> parser;
+ *
+ * while (read(socket, buffer, size, received)) {
+ *     if (!parser.Feed(buffer, received)) {
+ *         break; // Invalid JSON.
+ *     }
+ * }
+ *
+ * if (parser.Finish()) {
+ *     Value<char> value = parser.TakeValue();
+ * }
+ * @endcode
+ *
+ * @copyright Copyright (c) 2026 Hani Ammar
+ * @license MIT
+ */
+
+#ifndef QENTEM_JSON_PUSH_PARSER_H
+#define QENTEM_JSON_PUSH_PARSER_H
+
+#include "Qentem/Value.hpp"
+
+namespace Qentem {
+
+template <typename Char_T, typename Stream_T = StringStream<Char_T>>
+struct JSONPushParser {
+    using ValueT = Value<Char_T>;
+
+    JSONPushParser() = default;
+
+    // The tree stack points into value_.
+    JSONPushParser(const JSONPushParser &)            = delete;
+    JSONPushParser &operator=(const JSONPushParser &) = delete;
+
+    /**
+     * @brief Consumes the next chunk of the document.
+     *
+     * @return false once the input is known to be invalid; further chunks are ignored.
+     */
+    bool Feed(const Char_T *chunk, SizeT length) {
+        SizeT offset = 0;
+
+        while ((offset < length) && (state_ != State::Failed)) {
+            switch (state_) {
+                case State::String: {
+                    feedString(chunk, offset, length);
+                    break;
+                }
+
+                case State::Scalar: {
+                    feedScalar(chunk, offset, length);
+                    break;
+                }
+
+                default: {
+                    feedStructure(chunk, offset, length);
+                }
+            }
+        }
+
+        return (state_ != State::Failed);
+    }
+
+    /**
+     * @brief Ends the input.
+     *
+     * @return true if the chunks fed so far formed exactly one complete document.
+     */
+    bool Finish() noexcept {
+        if (state_ == State::Done) {
+            return true;
+        }
+
+        state_ = State::Failed;
+        value_.Reset();
+
+        return false;
+    }
+
+    QENTEM_INLINE bool IsDone() const noexcept {
+        return (state_ == State::Done);
+    }
+
+    QENTEM_INLINE bool IsFailed() const noexcept {
+        return (state_ == State::Failed);
+    }
+
+    QENTEM_INLINE ValueT &GetValue() noexcept {
+        return value_;
+    }
+
+    /**
+     * @brief Moves the parsed value out and readies the parser for the next document.
+     */
+    ValueT TakeValue() noexcept {
+        ValueT value{QUtility::Move(value_)};
+        Reset();
+
+        return value;
+    }
+
+    void Reset() noexcept {
+        value_.Reset();
+        tree_.Clear();
+        pending_.Clear();
+        stream_.Clear();
+
+        parent_    = nullptr;
+        obj_       = nullptr;
+        arr_       = nullptr;
+        obj_value_ = nullptr;
+        expecting_ = Expecting::Value;
+        state_     = State::Start;
+        scan_      = 0;
+    }
+
+  private:
+    using NotationConstants = JSONUtils::NotationConstants_T<Char_T>;
+    using ObjectT           = typename ValueT::ObjectT;
+    using ArrayT            = typename ValueT::ArrayT;
+
+    enum struct State : SizeT8 { Start, Structure, String, Scalar, Done, Failed };
+    enum struct Expecting : SizeT8 { KeyOrEnd, Key, Colon, ValueOrEnd, Value, CommaOrEnd };
+
+    QENTEM_INLINE static bool isWhiteSpace(const Char_T ch) noexcept {
+        return ((ch == NotationConstants::SpaceChar) || (ch == NotationConstants::LineControlChar) ||
+                (ch == NotationConstants::TabControlChar) || (ch == NotationConstants::CarriageControlChar));
+    }
+
+    QENTEM_INLINE void fail() noexcept {
+        state_ = State::Failed;
+        value_.Reset();
+    }
+
+    // Where the next value goes: the member whose key was just read, or a new array item.
+    QENTEM_INLINE ValueT &target() {
+        if (obj_value_ != nullptr) {
+            ValueT *item = obj_value_;
+            obj_value_   = nullptr;
+            return *item;
+        }
+
+        return arr_->Insert(ValueT{});
+    }
+
+    void feedStructure(const Char_T *chunk, SizeT &offset, const SizeT length) {
+        while (offset < length) {
+            const Char_T ch = chunk[offset];
+
+            if (isWhiteSpace(ch)) {
+                ++offset;
+                continue;
+            }
+
+            switch (state_) {
+                case State::Start: {
+                    // Like JSON::Parse, the document has to be an object or an array.
+                    if (ch == NotationConstants::SCurlyChar) {
+                        value_     = ValueT{ValueType::Object};
+                        expecting_ = Expecting::KeyOrEnd;
+                    } else if (ch == NotationConstants::SSquareChar) {
+                        value_     = ValueT{ValueType::Array};
+                        expecting_ = Expecting::ValueOrEnd;
+                    } else {
+                        fail();
+                        return;
+                    }
+
+                    parent_ = &value_;
+                    obj_    = parent_->GetObject();
+                    arr_    = parent_->GetArray();
+                    state_  = State::Structure;
+                    ++offset;
+                    continue;
+                }
+
+                case State::Done: {
+                    fail(); // Only whitespace may follow the document.
+                    return;
+                }
+
+                default: {
+                }
+            }
+
+            switch (expecting_) {
+                case Expecting::KeyOrEnd:
+                case Expecting::Key: {
+                    if (ch == NotationConstants::QuoteChar) {
+                        ++offset;
+                        state_ = State::String;
+                        return;
+                    }
+
+                    if ((ch == NotationConstants::ECurlyChar) && (expecting_ == Expecting::KeyOrEnd)) {
+                        ++offset;
+                        closeContainer();
+                        continue;
+                    }
+
+                    fail();
+                    return;
+                }
+
+                case Expecting::Colon: {
+                    if (ch == NotationConstants::ColonChar) {
+                        ++offset;
+                        expecting_ = Expecting::Value;
+                        continue;
+                    }
+
+                    fail();
+                    return;
+                }
+
+                case Expecting::ValueOrEnd:
+                case Expecting::Value: {
+                    if ((ch == NotationConstants::ESquareChar) && (expecting_ == Expecting::ValueOrEnd)) {
+                        ++offset;
+                        closeContainer();
+                        continue;
+                    }
+
+                    switch (ch) {
+                        case NotationConstants::QuoteChar: {
+                            ++offset;
+                            state_ = State::String;
+                            return;
+                        }
+
+                        case NotationConstants::SSquareChar:
+                        case NotationConstants::SCurlyChar: {
+                            const bool is_object = (ch == NotationConstants::SCurlyChar);
+                            ValueT    &item      = target();
+
+                            item = ValueT{is_object ? ValueType::Object : ValueType::Array};
+                            tree_ += parent_;
+                            parent_    = &item;
+                            obj_       = parent_->GetObject();
+                            arr_       = parent_->GetArray();
+                            expecting_ = (is_object ? Expecting::KeyOrEnd : Expecting::ValueOrEnd);
+                            ++offset;
+                            continue;
+                        }
+
+                        case NotationConstants::CommaChar:
+                        case NotationConstants::ColonChar:
+                        case NotationConstants::ECurlyChar:
+                        case NotationConstants::ESquareChar: {
+                            fail();
+                            return;
+                        }
+
+                        default: {
+                            // A number or a literal; its first character is read by feedScalar.
+                            state_ = State::Scalar;
+                            return;
+                        }
+                    }
+                }
+
+                case Expecting::CommaOrEnd: {
+                    if (ch == NotationConstants::CommaChar) {
+                        ++offset;
+                        expecting_ = ((obj_ != nullptr) ? Expecting::Key : Expecting::Value);
+                        continue;
+                    }
+
+                    if (((obj_ != nullptr) && (ch == NotationConstants::ECurlyChar)) ||
+                        ((arr_ != nullptr) && (ch == NotationConstants::ESquareChar))) {
+                        ++offset;
+                        closeContainer();
+                        continue;
+                    }
+
+                    fail();
+                    return;
+                }
+            }
+        }
+    }
+
+    void closeContainer() {
+        if (obj_ != nullptr) {
+#if QENTEM_VALUE_EXPANSION_MULTIPLIER > 2U
+            obj_->RemoveExcessStorage();
+#endif
+        } else {
+            arr_->Compress();
+        }
+
+        ValueT **last = tree_.Last();
+
+        if (last == nullptr) {
+            state_ = State::Done;
+            return;
+        }
+
+        parent_ = *last;
+        tree_.Drop(SizeT{1});
+        obj_       = parent_->GetObject();
+        arr_       = parent_->GetArray();
+        expecting_ = Expecting::CommaOrEnd;
+    }
+
+    // Reads up to the closing quote, stepping over escapes as JSONUtils::UnEscape() does, so a string ends
+    // where it ends for JSON::Parse. A string cut by the chunk boundary is kept in pending_; an escape cut by
+    // it is completed there one character at a time, from scan_.
+    void feedString(const Char_T *chunk, SizeT &offset, const SizeT length) {
+        while (scan_ != pending_.Length()) {
+            if (offset == length) {
+                return;
+            }
+
+            pending_.Write(chunk[offset]);
+            ++offset;
+
+            const SizeT available = (pending_.Length() - scan_);
+            const SizeT escape    = JSONUtils::EscapeLength((pending_.First() + scan_), available);
+
+            if (escape == 0) {
+                fail();
+                return;
+            }
+
+            if (escape == available) {
+                scan_ = pending_.Length();
+            }
+        }
+
+        const SizeT start = offset;
+
+        while (offset < length) {
+            const Char_T ch = chunk[offset];
+
+            if (ch == NotationConstants::QuoteChar) {
+                break;
+            }
+
+            if (ch == NotationConstants::BSlashChar) {
+                const SizeT escape = JSONUtils::EscapeLength((chunk + offset), (length - offset));
+
+                if (escape == 0) {
+                    fail();
+                    return;
+                }
+
+                if (escape > (length - offset)) {
+                    pending_.Write((chunk + start), (offset - start));
+                    scan_ = pending_.Length();
+                    pending_.Write((chunk + offset), (length - offset));
+                    offset = length;
+                    return;
+                }
+
+                offset += escape;
+                continue;
+            }
+
+            if ((ch == NotationConstants::LineControlChar) || (ch == NotationConstants::TabControlChar) ||
+                (ch == NotationConstants::CarriageControlChar)) {
+                fail();
+                return;
+            }
+
+            ++offset;
+        }
+
+        if (offset == length) {
+            pending_.Write((chunk + start), (offset - start));
+            scan_ = pending_.Length();
+            return;
+        }
+
+        ++offset; // The closing quote.
+
+        const Char_T *str = (chunk + start);
+        SizeT         len = (offset - start);
+
+        if (pending_.IsNotEmpty()) {
+            pending_.Write(str, len);
+            str = pending_.First();
+            len = pending_.Length();
+        }
+
+        if (JSONUtils::UnEscape(str, len, stream_) != len) {
+            fail();
+            return;
+        }
+
+        --len;
+
+        if (stream_.IsNotEmpty()) {
+            str = stream_.First();
+            len = stream_.Length();
+        }
+
+        if (expecting_ == Expecting::Value || expecting_ == Expecting::ValueOrEnd) {
+            target()   = ValueT{String<Char_T>{str, len}};
+            expecting_ = Expecting::CommaOrEnd;
+        } else {
+            obj_value_ = &((*obj_)[String<Char_T>{str, len}]);
+            expecting_ = Expecting::Colon;
+        }
+
+        pending_.Clear();
+        stream_.Clear();
+        scan_  = 0;
+        state_ = State::Structure;
+    }
+
+    // A number or a literal runs up to whitespace or a structural character.
+    void feedScalar(const Char_T *chunk, SizeT &offset, const SizeT length) {
+        const SizeT start = offset;
+
+        while (offset < length) {
+            const Char_T ch = chunk[offset];
+
+            if (isWhiteSpace(ch) || (ch == NotationConstants::CommaChar) || (ch == NotationConstants::ECurlyChar) ||
+                (ch == NotationConstants::ESquareChar) || (ch == NotationConstants::QuoteChar) ||
+                (ch == NotationConstants::ColonChar) || (ch == NotationConstants::SCurlyChar) ||
+                (ch == NotationConstants::SSquareChar)) {
+                break;
+            }
+
+            ++offset;
+        }
+
+        if (offset == length) {
+            pending_.Write((chunk + start), (offset - start));
+            return;
+        }
+
+        const Char_T *str = (chunk + start);
+        SizeT         len = (offset - start);
+
+        if (pending_.IsNotEmpty()) {
+            pending_.Write(str, len);
+            str = pending_.First();
+            len = pending_.Length();
+        }
+
+        ValueT &item = target();
+
+        if (isLiteral(str, len, NotationConstants::TrueString, NotationConstants::TrueStringLength)) {
+            item = ValueT{ValueType::True};
+        } else if (isLiteral(str, len, NotationConstants::FalseString, NotationConstants::FalseStringLength)) {
+            item = ValueT{ValueType::False};
+        } else if (isLiteral(str, len, NotationConstants::NullString, NotationConstants::NullStringLength)) {
+            item = ValueT{ValueType::Null};
+        } else {
+            QNumber64 number;
+            SizeT     number_offset = 0;
+
+            switch (Digit::StringToNumber(number, str, number_offset, len)) {
+                case QNumberType::Natural: {
+                    item = ValueT{number.Natural};
+                    break;
+                }
+
+                case QNumberType::Integer: {
+                    item = ValueT{number.Integer};
+                    break;
+                }
+
+                case QNumberType::Real: {
+                    item = ValueT{number.Real};
+                    break;
+                }
+
+                default: {
+                    number_offset = 0;
+                }
+            }
+
+            if (number_offset != len) {
+                fail();
+                return;
+            }
+        }
+
+        pending_.Clear();
+        expecting_ = Expecting::CommaOrEnd;
+        state_     = State::Structure;
+    }
+
+    QENTEM_INLINE static bool isLiteral(const Char_T *str, const SizeT len, const Char_T *literal,
+                                        const SizeT literal_length) noexcept {
+        return ((len == literal_length) && StringUtils::IsEqual(str, literal, len));
+    }
+
+    ValueT          value_{};
+    Array<ValueT *> tree_{};
+    Stream_T        pending_{}; ///< The part of a token seen before the chunk ended.
+    Stream_T        stream_{};  ///< Unescaped text.
+    ValueT         *parent_{nullptr};
+    ObjectT        *obj_{nullptr};
+    ArrayT         *arr_{nullptr};
+    ValueT         *obj_value_{nullptr};
+    Expecting       expecting_{Expecting::Value};
+    State           state_{State::Start};
+    SizeT           scan_{0}; ///< Where the string scan resumes in pending_.
+};
+
+} // namespace Qentem
+
+#endif
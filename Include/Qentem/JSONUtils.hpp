@@ -14,6 +14,7 @@
 #ifndef QENTEM_JSON_UTILS_H
 #define QENTEM_JSON_UTILS_H
 
+#include "Qentem/Platform.hpp"
 #include "Qentem/Digit.hpp"
 #include "Qentem/Unicode.hpp"
 
@@ -183,52 +184,100 @@ struct JSONUtils {
         return offset;
     }
 
+    /**
+     * @brief Number of characters UnEscape() consumes for the escape at content[0], a backslash.
+     *
+     * Only the first six characters decide it: two, six for a u escape, or twelve for a surrogate pair.
+     * A result larger than @p length means more input is needed; 0 means UnEscape() would fail.
+     */
+    template <typename Char_T>
+    static SizeT EscapeLength(const Char_T *content, SizeT length) noexcept {
+        using NotationConstants = NotationConstants_T<Char_T>;
+
+        if (length < SizeT{2}) {
+            return SizeT{2};
+        }
+
+        switch (content[1]) {
+            case NotationConstants::QuoteChar:
+            case NotationConstants::BSlashChar:
+            case NotationConstants::SlashChar:
+            case NotationConstants::B_Char:
+            case NotationConstants::T_Char:
+            case NotationConstants::N_Char:
+            case NotationConstants::F_Char:
+            case NotationConstants::R_Char: {
+                return SizeT{2};
+            }
+
+            case NotationConstants::CU_Char:
+            case NotationConstants::U_Char: {
+                if (length < SizeT{6}) {
+                    return SizeT{6};
+                }
+
+                if ((Digit::HexStringToNumber<SizeT32>((content + SizeT{2}), SizeT{4}) >> 8U) != 0xD8U) {
+                    return SizeT{6};
+                }
+
+                return SizeT{12};
+            }
+
+            default: {
+                return 0;
+            }
+        }
+    }
+
+    /**
+     * @brief Writes content to stream with JSON escapes applied.
+     *
+     * Runs without anything to escape are found a SIMD block at a time (for single-byte
+     * characters) and copied to the stream in one write.
+     */
     template <typename Char_T, typename Stream_T>
     static void Escape(const Char_T *content, SizeT length, Stream_T &stream) {
         using NotationConstants = NotationConstants_T<Char_T>;
 
-        static constexpr Char_T ReplaceList[] = {0, 0, 0, 0, 0, 0, 0, 0, 'b', 't', 'n', 0, 'f', 'r'};
-
-        SizeT offset  = 0;
+        SizeT offset  = findEscape(content, 0, length);
         SizeT offset2 = 0;
 
         while (offset < length) {
-            const Char_T ch = content[offset];
-
-            switch (ch) {
-                case NotationConstants::QuoteChar:
-                case NotationConstants::BSlashChar:
-                case NotationConstants::SlashChar: {
-                    stream.Write((content + offset2), (offset - offset2));
-                    stream.Write(NotationConstants::BSlashChar);
-                    stream.Write(ch);
+            stream.Write((content + offset2), (offset - offset2));
+            stream.Write(NotationConstants::BSlashChar);
+            stream.Write(escapeChar(content[offset]));
 
-                    offset2 = offset;
-                    ++offset2;
+            ++offset;
+            offset2 = offset;
+            offset  = findEscape(content, offset, length);
+        }
 
-                    break;
-                }
+        stream.Write((content + offset2), (offset - offset2));
+    }
 
-                case NotationConstants::BackSpaceControlChar:
-                case NotationConstants::TabControlChar:
-                case NotationConstants::LineControlChar:
-                case NotationConstants::FormfeedControlChar:
-                case NotationConstants::CarriageControlChar: {
-                    stream.Write((content + offset2), (offset - offset2));
-                    stream.Write(NotationConstants::BSlashChar);
-                    stream.Write(ReplaceList[static_cast<SizeT8>(ch)]);
+    /**
+     * @brief Length of content after Escape(); every escape adds one character.
+     */
+    template <typename Char_T>
+    static SizeT EscapedLength(const Char_T *content, SizeT length) noexcept {
+        SizeT extra{0};
+        SizeT offset{0};
 
-                    offset2 = offset;
-                    ++offset2;
+        if constexpr (QentemConfig::IsSIMDEnabled && (sizeof(Char_T) == 1U)) {
+            using SIMD = Platform::SIMD;
 
-                    break;
-                }
+            while ((length - offset) >= SIMD::Size) {
+                extra += Platform::PopCount(escapeMask(content + offset));
+                offset += SIMD::Size;
             }
+        }
 
+        while (offset < length) {
+            extra += SizeT(escapeChar(content[offset]) != Char_T{0});
             ++offset;
         }
 
-        stream.Write((content + offset2), (offset - offset2));
+        return (length + extra);
     }
 
     /**
@@ -275,6 +324,77 @@ struct JSONUtils {
         static constexpr SizeT         NullStringLength = SizeT{4};
         static constexpr const Char_T *NullString       = &(JSONLiterals_T<Char_T, sizeof(Char_T)>::NullString[0]);
     };
+
+  private:
+    // The character that follows the backslash, or zero if ch is written as-is.
+    template <typename Char_T>
+    QENTEM_INLINE static Char_T escapeChar(Char_T ch) noexcept {
+        using NotationConstants = NotationConstants_T<Char_T>;
+
+        static constexpr Char_T ReplaceList[] = {0, 0, 0, 0, 0, 0, 0, 0, 'b', 't', 'n', 0, 'f', 'r'};
+
+        switch (ch) {
+            case NotationConstants::QuoteChar:
+            case NotationConstants::BSlashChar:
+            case NotationConstants::SlashChar: {
+                return ch;
+            }
+
+            case NotationConstants::BackSpaceControlChar:
+            case NotationConstants::TabControlChar:
+            case NotationConstants::LineControlChar:
+            case NotationConstants::FormfeedControlChar:
+            case NotationConstants::CarriageControlChar: {
+                return ReplaceList[static_cast<SizeT8>(ch)];
+            }
+
+            default: {
+                return Char_T{0};
+            }
+        }
+    }
+
+    template <typename Char_T>
+    static Platform::SIMD::Number_T escapeMask(const Char_T *block) noexcept {
+        using NotationConstants = NotationConstants_T<Char_T>;
+        using SIMD              = Platform::SIMD;
+        using VAR_T             = typename SIMD::VAR_T;
+
+        const VAR_T value = SIMD::Load(reinterpret_cast<const VAR_T *>(block));
+
+        return (SIMD::Compare8Bit(value, SIMD::SetToOne8Bit(NotationConstants::QuoteChar)) |
+                SIMD::Compare8Bit(value, SIMD::SetToOne8Bit(NotationConstants::BSlashChar)) |
+                SIMD::Compare8Bit(value, SIMD::SetToOne8Bit(NotationConstants::SlashChar)) |
+                SIMD::Compare8Bit(value, SIMD::SetToOne8Bit(NotationConstants::BackSpaceControlChar)) |
+                SIMD::Compare8Bit(value, SIMD::SetToOne8Bit(NotationConstants::TabControlChar)) |
+                SIMD::Compare8Bit(value, SIMD::SetToOne8Bit(NotationConstants::LineControlChar)) |
+                SIMD::Compare8Bit(value, SIMD::SetToOne8Bit(NotationConstants::FormfeedControlChar)) |
+                SIMD::Compare8Bit(value, SIMD::SetToOne8Bit(NotationConstants::CarriageControlChar)));
+    }
+
+    // Offset of the next character that needs escaping, or length.
+    template <typename Char_T>
+    static SizeT findEscape(const Char_T *content, SizeT offset, SizeT length) noexcept {
+        if constexpr (QentemConfig::IsSIMDEnabled && (sizeof(Char_T) == 1U)) {
+            using SIMD = Platform::SIMD;
+
+            while ((length - offset) >= SIMD::Size) {
+                const typename SIMD::Number_T bits = escapeMask(content + offset);
+
+                if (bits != 0) {
+                    return (offset + Platform::FindFirstBit(bits));
+                }
+
+                offset += SIMD::Size;
+            }
+        }
+
+        while ((offset < length) && (escapeChar(content[offset]) == Char_T{0})) {
+            ++offset;
+        }
+
+        return offset;
+    }
 };
 
 } // namespace Qentem
@@ -0,0 +1,64 @@
+/**
+ * @file KeyTable.hpp
+ * @brief Interns object keys, so objects with the same keys share one copy of each.
+ *
+ * An array of records holds the same few keys in every object. Each object normally owns
+ * its keys, so 100k records of 12 keys make 1.2M strings. KeyTable keeps one copy of each
+ * key it is given, and Key() returns a String that refers to that copy (see
+ * String::Borrow) along with the key's hash, ready for the object's table. Keys short
+ * enough to fit inside a String are returned inline, as they need no storage to begin with.
+ *
+ * Used by JSON::ParseInterned() and ValueBuilder, and by anything else that fills objects
+ * with repeated keys. The table must outlive every value holding its keys; a copy of such a
+ * value holds its own keys.
+ *
+ * @copyright Copyright (c) 2026 Hani Ammar
+ * @license MIT
+ */
+
+#ifndef QENTEM_KEY_TABLE_H
+#define QENTEM_KEY_TABLE_H
+
+#include "Qentem/HList.hpp"
+#include "Qentem/String.hpp"
+
+namespace Qentem {
+
+template <typename Char_T>
+struct KeyTable {
+    using StringT = String<Char_T>;
+
+    /**
+     * @brief A key for an object: inline if it fits, otherwise borrowing the table's copy.
+     *
+     * @param hash Receives the key's hash, for HArray's insert that takes one.
+     */
+    StringT Key(const Char_T *str, SizeT length, SizeT &hash) {
+        StringT key;
+        hash = StringUtils::Hash<Char_T, SizeT>(str, length);
+
+        if (length > StringT::InlineCapacity) {
+            const auto *item = keys_.GetItem(str, length, hash);
+            // A String keeps long text in storage of its own, so it stays put as the table grows.
+            const StringT &interned = ((item != nullptr) ? item->Key : keys_.Get(StringT{str, length}, hash));
+
+            key.Borrow(interned.First(), length);
+        } else {
+            key.Write(str, length);
+        }
+
+        return key;
+    }
+
+    // The number of keys kept; inline ones are not.
+    QENTEM_INLINE SizeT Size() const noexcept {
+        return keys_.Size();
+    }
+
+  private:
+    HList<StringT> keys_{};
+};
+
+} // namespace Qentem
+
+#endif
@@ -131,6 +131,18 @@ static constexpr SystemLongI Q_NOFOLLOW = 00400000;
 
 /** @} */
 
+/**
+ * @name lseek() Whence Values
+ * @{
+ */
+
+/**
+ * @brief Seek relative to the end of the file.
+ */
+static constexpr SystemLongI Q_SEEK_END = 2;
+
+/** @} */
+
 } // namespace Qentem
 
 #endif
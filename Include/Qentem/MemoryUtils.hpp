@@ -346,6 +346,24 @@ struct MemoryUtils {
             ++item;
         }
     }
+
+    ///////////////////////////////////////////////////////////
+    //                    Relocation                         //
+    ///////////////////////////////////////////////////////////
+
+    /**
+     * @brief Relocates from[entries[i].Index] to to[i] for each entry, as bytes.
+     *
+     * Puts items in the order of sorted entries, whose Index is where each came from. Items
+     * are relocated as containers do when they grow: nothing is constructed, assigned or
+     * destroyed, and the ones at from are left to be overwritten, not destructed.
+     */
+    template <typename Type_T, typename Entry_T, typename Number_T>
+    QENTEM_INLINE static void Gather(Type_T *to, const Type_T *from, const Entry_T *entries, Number_T count) noexcept {
+        for (Number_T index = 0; index < count; index++) {
+            CopyTo((to + index), (from + entries[index].Index), Number_T{1});
+        }
+    }
 };
 
 } // namespace Qentem
@@ -0,0 +1,172 @@
+/**
+ * @file MessageBundle.hpp
+ * @brief Pre-compiled message formats for the `{svar:...}` template tag.
+ *
+ * A MessageBundle holds the translated format strings of one locale, keyed by message id.
+ * Each format string (e.g. "Welcome {0} to {1}.") is split once into literal spans and
+ * argument indexes, with every literal already HTML-escaped, so rendering a super variable
+ * only writes spans and sub-tags without scanning for placeholders or escaping again.
+ *
+ * @copyright Copyright (c) 2026 Hani Ammar
+ * @license MIT
+ */
+
+#ifndef QENTEM_MESSAGE_BUNDLE_H
+#define QENTEM_MESSAGE_BUNDLE_H
+
+#include "Qentem/HArray.hpp"
+#include "Qentem/String.hpp"
+#include "Qentem/StringUtils.hpp"
+#include "Qentem/DigitUtils.hpp"
+#include "Qentem/Tags.hpp"
+
+namespace Qentem {
+
+/**
+ * @brief One piece of a compiled message: an escaped literal followed by an argument.
+ *
+ * The last segment of a message holds the trailing literal only; its Index is unused.
+ */
+struct MessageSegment {
+    SizeT Offset{0}; ///< Offset of the escaped literal in MessageFormat::Text.
+    SizeT Length{0}; ///< Length of the escaped literal.
+    SizeT Index{0};  ///< Argument index following the literal.
+};
+
+/**
+ * @brief A format string split into segments, ready for rendering.
+ *
+ * Format keeps the original string for tags that pass fewer arguments than the
+ * message refers to; those are rendered by the regular scan to keep its output.
+ */
+template <typename Char_T>
+struct MessageFormat {
+    String<Char_T>        Text{};
+    String<Char_T>        Format{};
+    Array<MessageSegment> Segments{};
+    SizeT                 Arguments{0}; ///< Highest referenced argument index plus one.
+};
+
+/**
+ * @brief Per-locale table of compiled `svar` messages, keyed by message id.
+ *
+ * The id is the variable name as written in the template (`welcome_x_to_y` in
+ * `{svar:welcome_x_to_y, {var:name}, {var:site}}`). Placeholder matching follows
+ * the rules of the uncompiled path, so both produce the same output.
+ */
+template <typename Char_T>
+struct MessageBundle {
+    using MessageFormatT = MessageFormat<Char_T>;
+
+    /**
+     * @brief Compiles and stores a format string under the given id, replacing any previous one.
+     */
+    void Add(const Char_T *id, SizeT id_length, const Char_T *format, SizeT length) {
+        MessageFormatT &message = messages_.Get(id, id_length);
+
+        message.Text.Clear();
+        message.Segments.Clear();
+        message.Arguments = 0;
+        message.Format    = String<Char_T>{format, length};
+        Compile(message, format, length);
+    }
+
+    /**
+     * @brief Compiles every string member of an object value, using its keys as ids.
+     */
+    template <typename Value_T>
+    void Load(const Value_T &messages) {
+        const SizeT size = messages.Size();
+        SizeT       index{0};
+
+        while (index < size) {
+            const auto    *key   = messages.GetKeyAt(index);
+            const Value_T *value = messages.GetValueAt(index);
+            const Char_T  *format;
+            SizeT          length;
+
+            if ((key != nullptr) && (value != nullptr) && value->SetCharAndLength(format, length)) {
+                Add(key->First(), key->Length(), format, length);
+            }
+
+            ++index;
+        }
+    }
+
+    QENTEM_INLINE const MessageFormatT *Find(const Char_T *id, SizeT length) const noexcept {
+        return messages_.GetValue(id, length);
+    }
+
+    QENTEM_INLINE SizeT Size() const noexcept {
+        return messages_.Size();
+    }
+
+    QENTEM_INLINE bool IsEmpty() const noexcept {
+        return messages_.IsEmpty();
+    }
+
+    QENTEM_INLINE void Reset() noexcept {
+        messages_.Reset();
+    }
+
+  private:
+    /**
+     * @brief Splits a format string into escaped literals and `{N}` argument indexes.
+     *
+     * Mirrors the scan in TemplateCore::renderSuperVariable: a '{' followed by one character
+     * and a '}' is a placeholder; anything else stays literal.
+     */
+    static void Compile(MessageFormatT &message, const Char_T *format, SizeT length) {
+        using TagPatterns = Tags::TagPatterns_T<Char_T>;
+
+        SizeT index{0};
+        SizeT last_index{0};
+
+        while (index < length) {
+            if (format[index] == TagPatterns::InLineFirstChar) {
+                const SizeT start = index;
+                ++index;
+
+                if (index < length) {
+                    const SizeT id = static_cast<SizeT>(format[index] - DigitUtils::DigitChar::Zero);
+                    ++index;
+
+                    if ((index < length) && (format[index] == TagPatterns::InLineLastChar)) {
+                        ++index;
+
+                        addSegment(message, (format + last_index), (start - last_index)).Index = id;
+                        last_index = index;
+
+                        // Non-digit placeholders wrap to large ids; saturate so they always fall back.
+                        if ((message.Arguments <= id) && (id != ~SizeT{0})) {
+                            message.Arguments = (id + SizeT{1});
+                        } else if (id == ~SizeT{0}) {
+                            message.Arguments = id;
+                        }
+
+                        continue;
+                    }
+                }
+            }
+
+            ++index;
+        }
+
+        addSegment(message, (format + last_index), (index - last_index));
+    }
+
+    static MessageSegment &addSegment(MessageFormatT &message, const Char_T *str, SizeT length) {
+        MessageSegment &segment = message.Segments.Insert(MessageSegment{});
+        segment.Offset          = message.Text.Length();
+        StringUtils::EscapeHTMLSpecialChars(message.Text, str, length);
+        segment.Length = (message.Text.Length() - segment.Offset);
+
+        return segment;
+    }
+
+    HArray<String<Char_T>, MessageFormatT> messages_{};
+};
+
+} // namespace Qentem
+
+#endif
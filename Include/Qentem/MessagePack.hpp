@@ -0,0 +1,704 @@
+/**
+ * @file MessagePack.hpp
+ * @brief Binary encoding of Value trees in the MessagePack format.
+ *
+ * MessagePack carries numbers in their machine form, so passing a Value between
+ * processes this way skips number-to-text and text-to-number conversion on both ends.
+ * Strings are length-prefixed and arrays and objects carry their size up front, letting
+ * the decoder reserve each container once.
+ *
+ * Every ValueType keeps its identity through a round trip: UIntLong is written with the
+ * unsigned formats, IntLong with the signed ones (a positive IntLong is never narrowed to
+ * an unsigned format) and Double as float64. Each number takes the smallest format of its
+ * family.
+ *
+ * Strings hold Char_T code units as they are in memory; for Value<char> the output is plain
+ * MessagePack. Undefined items are left out, and map and array headers count only the rest.
+ *
+ * Decoding is iterative, like JSON::Parse, so nesting depth is bounded by memory rather than
+ * the call stack. Binary and extension types are not supported and fail decoding.
+ *
+ * @copyright Copyright (c) 2026 Hani Ammar
+ * @license MIT
+ */
+
+#ifndef QENTEM_MESSAGE_PACK_H
+#define QENTEM_MESSAGE_PACK_H
+
+#include "Qentem/Value.hpp"
+
+namespace Qentem {
+
+struct MessagePack {
+    /**
+     * @brief Appends the encoding of value to stream; the stream is sized for it first.
+     */
+    template <typename Char_T, typename Stream_T>
+    static Stream_T &Encode(const Value<Char_T> &value, Stream_T &stream) {
+        stream.Expect(encodedLength(value));
+        encode(value, stream);
+
+        return stream;
+    }
+
+    template <typename Char_T>
+    QENTEM_INLINE static StringStream<char> Encode(const Value<Char_T> &value) {
+        StringStream<char> stream;
+        Encode(value, stream);
+
+        return stream;
+    }
+
+    /**
+     * @brief Decodes one value spanning exactly length bytes.
+     *
+     * @return The value, or an undefined value if the data is malformed, uses an unsupported
+     *         type, or has bytes left over.
+     */
+    template <typename Char_T = char>
+    static Value<Char_T> Decode(const char *data, SizeT length) {
+        using ValueT = Value<Char_T>;
+
+        Array<Frame<Char_T>> stack;
+        ValueT               root;
+        ValueT              *target = &root;
+        SizeT                offset{0};
+
+        while (true) {
+            SizeT count{0};
+
+            switch (decodeItem(data, offset, length, *target, count)) {
+                case Item::Scalar: {
+                    break;
+                }
+
+                case Item::Array: {
+                    if (count != 0) {
+                        stack += Frame<Char_T>{target, count, false};
+                    }
+
+                    break;
+                }
+
+                case Item::Object: {
+                    if (count != 0) {
+                        stack += Frame<Char_T>{target, count, true};
+                    }
+
+                    break;
+                }
+
+                default: {
+                    return ValueT{};
+                }
+            }
+
+            Frame<Char_T> *frame = stack.Last();
+
+            while ((frame != nullptr) && (frame->Remaining == 0)) {
+                stack.Drop(1);
+                frame = stack.Last();
+            }
+
+            if (frame == nullptr) {
+                break;
+            }
+
+            --(frame->Remaining);
+
+            if (frame->IsObject) {
+                typename ValueT::StringT key;
+
+                if (!decodeString(data, offset, length, key)) {
+                    return ValueT{};
+                }
+
+                target = &(frame->Container->GetObject()->Get(QUtility::Move(key)));
+            } else {
+                target = &(frame->Container->GetArray()->Insert(ValueT{}));
+            }
+        }
+
+        if (offset != length) {
+            return ValueT{};
+        }
+
+        return root;
+    }
+
+  private:
+    // Format bytes; see the MessagePack specification.
+    static constexpr SizeT8 PositiveFixIntMax{0x7F};
+    static constexpr SizeT8 FixMap{0x80};
+    static constexpr SizeT8 FixArray{0x90};
+    static constexpr SizeT8 FixStr{0xA0};
+    static constexpr SizeT8 Nil{0xC0};
+    static constexpr SizeT8 False{0xC2};
+    static constexpr SizeT8 True{0xC3};
+    static constexpr SizeT8 Float32{0xCA};
+    static constexpr SizeT8 Float64{0xCB};
+    static constexpr SizeT8 UInt8{0xCC};
+    static constexpr SizeT8 UInt16{0xCD};
+    static constexpr SizeT8 UInt32{0xCE};
+    static constexpr SizeT8 UInt64{0xCF};
+    static constexpr SizeT8 Int8{0xD0};
+    static constexpr SizeT8 Int16{0xD1};
+    static constexpr SizeT8 Int32{0xD2};
+    static constexpr SizeT8 Int64{0xD3};
+    static constexpr SizeT8 Str8{0xD9};
+    static constexpr SizeT8 Str16{0xDA};
+    static constexpr SizeT8 Str32{0xDB};
+    static constexpr SizeT8 Array16{0xDC};
+    static constexpr SizeT8 Array32{0xDD};
+    static constexpr SizeT8 Map16{0xDE};
+    static constexpr SizeT8 Map32{0xDF};
+    static constexpr SizeT8 NegativeFixInt{0xE0};
+
+    enum struct Item : SizeT8 { Invalid, Scalar, Array, Object };
+
+    template <typename Char_T>
+    struct Frame {
+        Value<Char_T> *Container;
+        SizeT          Remaining;
+        bool           IsObject;
+    };
+
+    template <typename Stream_T>
+    static void writeBigEndian(Stream_T &stream, SizeT8 format, SizeT64 number, SizeT32 bytes) {
+        char *str = stream.Buffer(SizeT(bytes + SizeT32{1}));
+
+        *str = char(format);
+
+        while (bytes != 0) {
+            --bytes;
+            ++str;
+            *str = char(SizeT8(number >> (bytes * 8U)));
+        }
+    }
+
+    QENTEM_INLINE static SizeT64 readBigEndian(const char *data, SizeT32 bytes) noexcept {
+        SizeT64 number{0};
+        SizeT32 index{0};
+
+        while (index < bytes) {
+            number = ((number << 8U) | SizeT64(SizeT8(data[index])));
+            ++index;
+        }
+
+        return number;
+    }
+
+    // Bytes after the format byte for a string, array or map header of the given size.
+    QENTEM_INLINE static SizeT32 headerBytes(SizeT size, SizeT fix_max) noexcept {
+        if (size <= fix_max) {
+            return 0;
+        }
+
+        if (size <= SizeT{0xFFFF}) {
+            return 2U;
+        }
+
+        return 4U;
+    }
+
+    template <typename Stream_T>
+    static void writeHeader(Stream_T &stream, SizeT size, SizeT8 fix, SizeT fix_max, SizeT8 format16,
+                            SizeT8 format32) {
+        switch (headerBytes(size, fix_max)) {
+            case 0: {
+                stream.Write(char(SizeT8(fix | SizeT8(size))));
+                break;
+            }
+
+            case 2U: {
+                writeBigEndian(stream, format16, size, 2U);
+                break;
+            }
+
+            default: {
+                writeBigEndian(stream, format32, size, 4U);
+            }
+        }
+    }
+
+    // Bytes after the format byte for an unsigned number, or 0 for a positive fixint.
+    QENTEM_INLINE static SizeT32 unsignedBytes(SizeT64 number) noexcept {
+        if (number <= SizeT64{PositiveFixIntMax}) {
+            return 0;
+        }
+
+        if (number <= SizeT64{0xFF}) {
+            return 1U;
+        }
+
+        if (number <= SizeT64{0xFFFF}) {
+            return 2U;
+        }
+
+        if (number <= SizeT64{0xFFFFFFFF}) {
+            return 4U;
+        }
+
+        return 8U;
+    }
+
+    // Bytes after the format byte for a signed number, or 0 for a negative fixint.
+    QENTEM_INLINE static SizeT32 signedBytes(SizeT64I number) noexcept {
+        if ((number < 0) && (number >= SizeT64I{-32})) {
+            return 0;
+        }
+
+        if ((number >= SizeT64I{-128}) && (number <= SizeT64I{127})) {
+            return 1U;
+        }
+
+        if ((number >= SizeT64I{-32768}) && (number <= SizeT64I{32767})) {
+            return 2U;
+        }
+
+        if ((number >= SizeT64I{-2147483647} - 1) && (number <= SizeT64I{2147483647})) {
+            return 4U;
+        }
+
+        return 8U;
+    }
+
+    QENTEM_INLINE static SizeT8 sizedFormat(SizeT8 format8, SizeT32 bytes) noexcept {
+        // 8, 16, 32 and 64-bit formats are consecutive.
+        return SizeT8(format8 + SizeT8(Platform::FindFirstBit(bytes)));
+    }
+
+    template <typename Char_T>
+    static SizeT countItems(const Value<Char_T> &value) noexcept {
+        SizeT count{0};
+
+        if (const typename Value<Char_T>::ObjectT *obj = value.GetObject()) {
+            const typename Value<Char_T>::VItem *h_item = obj->First();
+            const typename Value<Char_T>::VItem *end    = (h_item + obj->Size());
+
+            while (h_item != end) {
+                count += SizeT((h_item != nullptr) && !(h_item->Value.IsUndefined()));
+                ++h_item;
+            }
+        } else if (const typename Value<Char_T>::ArrayT *arr = value.GetArray()) {
+            for (const Value<Char_T> &item : *arr) {
+                count += SizeT(!(item.IsUndefined()));
+            }
+        }
+
+        return count;
+    }
+
+    // Bytes after the format byte for a string header; strings also have an 8-bit size format.
+    QENTEM_INLINE static SizeT32 stringHeaderBytes(SizeT bytes) noexcept {
+        if ((bytes > SizeT{31}) && (bytes <= SizeT{0xFF})) {
+            return 1U;
+        }
+
+        return headerBytes(bytes, SizeT{31});
+    }
+
+    template <typename Char_T>
+    QENTEM_INLINE static SizeT stringLength(SizeT length) noexcept {
+        const SizeT bytes = SizeT(length * sizeof(Char_T));
+        return (SizeT{1} + stringHeaderBytes(bytes) + bytes);
+    }
+
+    template <typename Char_T>
+    static SizeT encodedLength(const Value<Char_T> &value) noexcept {
+        QNumber64 number;
+
+        switch (value.TargetType()) {
+            case ValueType::Object: {
+                const typename Value<Char_T>::ObjectT *obj    = value.GetObject();
+                const typename Value<Char_T>::VItem   *h_item = obj->First();
+                const typename Value<Char_T>::VItem   *end    = (h_item + obj->Size());
+                const SizeT                            count  = countItems(value);
+                SizeT                                  length = (SizeT{1} + headerBytes(count, SizeT{15}));
+
+                while (h_item != end) {
+                    if ((h_item != nullptr) && !(h_item->Value.IsUndefined())) {
+                        length += stringLength<Char_T>(h_item->Key.Length());
+                        length += encodedLength(h_item->Value);
+                    }
+
+                    ++h_item;
+                }
+
+                return length;
+            }
+
+            case ValueType::Array: {
+                const SizeT count  = countItems(value);
+                SizeT       length = (SizeT{1} + headerBytes(count, SizeT{15}));
+
+                for (const Value<Char_T> &item : *(value.GetArray())) {
+                    if (!(item.IsUndefined())) {
+                        length += encodedLength(item);
+                    }
+                }
+
+                return length;
+            }
+
+            case ValueType::String: {
+                return stringLength<Char_T>(value.GetString()->Length());
+            }
+
+            case ValueType::UIntLong: {
+                value.SetNumber(number);
+                return (SizeT{1} + unsignedBytes(number.Natural));
+            }
+
+            case ValueType::IntLong: {
+                value.SetNumber(number);
+                return (SizeT{1} + signedBytes(number.Integer));
+            }
+
+            case ValueType::Double: {
+                return SizeT{9};
+            }
+
+            case ValueType::True:
+            case ValueType::False:
+            case ValueType::Null: {
+                return SizeT{1};
+            }
+
+            default: {
+                return 0;
+            }
+        }
+    }
+
+    template <typename Char_T, typename Stream_T>
+    static void encodeString(const Char_T *str, SizeT length, Stream_T &stream) {
+        const SizeT bytes = SizeT(length * sizeof(Char_T));
+
+        if (stringHeaderBytes(bytes) == 1U) {
+            writeBigEndian(stream, Str8, bytes, 1U);
+        } else {
+            writeHeader(stream, bytes, FixStr, SizeT{31}, Str16, Str32);
+        }
+
+        stream.Write(reinterpret_cast<const char *>(str), bytes);
+    }
+
+    template <typename Char_T, typename Stream_T>
+    static void encode(const Value<Char_T> &value, Stream_T &stream) {
+        QNumber64 number;
+
+        switch (value.TargetType()) {
+            case ValueType::Object: {
+                const typename Value<Char_T>::ObjectT *obj    = value.GetObject();
+                const typename Value<Char_T>::VItem   *h_item = obj->First();
+                const typename Value<Char_T>::VItem   *end    = (h_item + obj->Size());
+
+                writeHeader(stream, countItems(value), FixMap, SizeT{15}, Map16, Map32);
+
+                while (h_item != end) {
+                    if ((h_item != nullptr) && !(h_item->Value.IsUndefined())) {
+                        encodeString(h_item->Key.First(), h_item->Key.Length(), stream);
+                        encode(h_item->Value, stream);
+                    }
+
+                    ++h_item;
+                }
+
+                break;
+            }
+
+            case ValueType::Array: {
+                writeHeader(stream, countItems(value), FixArray, SizeT{15}, Array16, Array32);
+
+                for (const Value<Char_T> &item : *(value.GetArray())) {
+                    if (!(item.IsUndefined())) {
+                        encode(item, stream);
+                    }
+                }
+
+                break;
+            }
+
+            case ValueType::String: {
+                encodeString(value.GetString()->First(), value.GetString()->Length(), stream);
+                break;
+            }
+
+            case ValueType::UIntLong: {
+                value.SetNumber(number);
+                const SizeT32 bytes = unsignedBytes(number.Natural);
+
+                if (bytes == 0) {
+                    stream.Write(char(SizeT8(number.Natural)));
+                } else {
+                    writeBigEndian(stream, sizedFormat(UInt8, bytes), number.Natural, bytes);
+                }
+
+                break;
+            }
+
+            case ValueType::IntLong: {
+                value.SetNumber(number);
+                const SizeT32 bytes = signedBytes(number.Integer);
+
+                if (bytes == 0) {
+                    stream.Write(char(SizeT8(number.Natural)));
+                } else {
+                    writeBigEndian(stream, sizedFormat(Int8, bytes), number.Natural, bytes);
+                }
+
+                break;
+            }
+
+            case ValueType::Double: {
+                value.SetNumber(number);
+                writeBigEndian(stream, Float64, number.Natural, 8U);
+                break;
+            }
+
+            case ValueType::True: {
+                stream.Write(char(True));
+                break;
+            }
+
+            case ValueType::False: {
+                stream.Write(char(False));
+                break;
+            }
+
+            case ValueType::Null: {
+                stream.Write(char(Nil));
+                break;
+            }
+
+            default: {
+            }
+        }
+    }
+
+    // Reads a string header and its code units into str.
+    template <typename Char_T>
+    static bool decodeString(const char *data, SizeT &offset, SizeT length, String<Char_T> &str) {
+        if (offset == length) {
+            return false;
+        }
+
+        const SizeT8 format = SizeT8(data[offset]);
+        SizeT32      bytes{0};
+        SizeT64      size;
+
+        ++offset;
+
+        if ((format & SizeT8{0xE0}) == FixStr) {
+            size = SizeT64(format & SizeT8{0x1F});
+        } else if ((format >= Str8) && (format <= Str32)) {
+            bytes = (SizeT32{1} << SizeT32(format - Str8));
+
+            if ((length - offset) < bytes) {
+                return false;
+            }
+
+            size = readBigEndian((data + offset), bytes);
+            offset += bytes;
+        } else {
+            return false;
+        }
+
+        if ((size > SizeT64(length - offset)) || ((size % sizeof(Char_T)) != 0)) {
+            return false;
+        }
+
+        if (size != 0) {
+            MemoryUtils::CopyTo(reinterpret_cast<char *>(str.Buffer(SizeT(size / sizeof(Char_T)))), (data + offset),
+                                SizeT(size));
+            offset += SizeT(size);
+        }
+
+        return true;
+    }
+
+    /*
+     * Decodes the item at offset into value. Arrays and objects are created empty with their
+     * storage reserved; their item count is returned in count and they are filled by Decode().
+     */
+    template <typename Char_T>
+    static Item decodeItem(const char *data, SizeT &offset, SizeT length, Value<Char_T> &value, SizeT &count) {
+        using ValueT = Value<Char_T>;
+
+        if (offset == length) {
+            return Item::Invalid;
+        }
+
+        const SizeT8 format = SizeT8(data[offset]);
+
+        if ((format <= PositiveFixIntMax) || (format >= NegativeFixInt)) {
+            ++offset;
+
+            if (format <= PositiveFixIntMax) {
+                value = SizeT64(format);
+            } else {
+                value = SizeT64I(static_cast<signed char>(format));
+            }
+
+            return Item::Scalar;
+        }
+
+        if ((format & SizeT8{0xE0}) == FixStr) {
+            typename ValueT::StringT str;
+
+            if (!decodeString(data, offset, length, str)) {
+                return Item::Invalid;
+            }
+
+            value = QUtility::Move(str);
+
+            return Item::Scalar;
+        }
+
+        ++offset;
+
+        SizeT32 bytes{0};
+        bool    is_object;
+
+        switch (format) {
+            case Nil: {
+                value = nullptr;
+                return Item::Scalar;
+            }
+
+            case False: {
+                value = false;
+                return Item::Scalar;
+            }
+
+            case True: {
+                value = true;
+                return Item::Scalar;
+            }
+
+            case Float32: {
+                if ((length - offset) < 4U) {
+                    return Item::Invalid;
+                }
+
+                QNumber32 number;
+                number.Natural = SizeT32(readBigEndian((data + offset), 4U));
+                offset += 4U;
+                value = double(number.Real);
+
+                return Item::Scalar;
+            }
+
+            case Float64: {
+                if ((length - offset) < 8U) {
+                    return Item::Invalid;
+                }
+
+                QNumber64 number;
+                number.Natural = readBigEndian((data + offset), 8U);
+                offset += 8U;
+                value = number.Real;
+
+                return Item::Scalar;
+            }
+
+            case UInt8:
+            case UInt16:
+            case UInt32:
+            case UInt64:
+            case Int8:
+            case Int16:
+            case Int32:
+            case Int64: {
+                const bool is_signed = (format >= Int8);
+                bytes                = (SizeT32{1} << SizeT32(format - (is_signed ? Int8 : UInt8)));
+
+                if ((length - offset) < bytes) {
+                    return Item::Invalid;
+                }
+
+                const SizeT64 number = readBigEndian((data + offset), bytes);
+                offset += bytes;
+
+                if (is_signed) {
+                    // Sign-extend from the encoded width.
+                    const SizeT32 shift = (64U - (bytes * 8U));
+                    value               = SizeT64I(SizeT64I(number << shift) >> shift);
+                } else {
+                    value = number;
+                }
+
+                return Item::Scalar;
+            }
+
+            case Str8:
+            case Str16:
+            case Str32: {
+                typename ValueT::StringT str;
+                --offset;
+
+                if (!decodeString(data, offset, length, str)) {
+                    return Item::Invalid;
+                }
+
+                value = QUtility::Move(str);
+
+                return Item::Scalar;
+            }
+
+            case Array16:
+            case Map16: {
+                bytes     = 2U;
+                is_object = (format == Map16);
+                break;
+            }
+
+            case Array32:
+            case Map32: {
+                bytes     = 4U;
+                is_object = (format == Map32);
+                break;
+            }
+
+            default: {
+                if ((format & SizeT8{0xF0}) == FixMap) {
+                    is_object = true;
+                } else if ((format & SizeT8{0xF0}) == FixArray) {
+                    is_object = false;
+                } else {
+                    return Item::Invalid;
+                }
+            }
+        }
+
+        if (bytes == 0) {
+            count = SizeT(format & SizeT8{0x0F});
+        } else {
+            if ((length - offset) < bytes) {
+                return Item::Invalid;
+            }
+
+            count = SizeT(readBigEndian((data + offset), bytes));
+            offset += bytes;
+        }
+
+        // Every item takes at least one byte (two for a key and its value), which also keeps a
+        // bogus size from reserving more than the input could ever fill.
+        if (SizeT64(count) * (is_object ? 2U : 1U) > SizeT64(length - offset)) {
+            return Item::Invalid;
+        }
+
+        if (is_object) {
+            value = ValueT{ValueType::Object, count};
+            return Item::Object;
+        }
+
+        value = ValueT{ValueType::Array, count};
+        return Item::Array;
+    }
+};
+
+} // namespace Qentem
+
+#endif
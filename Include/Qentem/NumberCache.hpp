@@ -0,0 +1,111 @@
+/**
+ * @file NumberCache.hpp
+ * @brief Per-thread cache of formatted real numbers for repeated template output.
+ *
+ * Formatting a double goes through BigInt arithmetic, yet rendered pages tend to print the
+ * same prices and quantities many times over. NumberCache keeps a small direct-mapped table
+ * per thread, keyed by the number's bit pattern and the RealFormatInfo it was formatted with,
+ * so a repeated number costs a copy instead of a conversion. Being thread-local, it takes no locks.
+ *
+ * The table size is set by QENTEM_NUMBER_CACHE_SIZE; 0 disables caching.
+ *
+ * @copyright Copyright (c) 2026 Hani Ammar
+ * @license MIT
+ */
+
+#ifndef QENTEM_NUMBER_CACHE_H
+#define QENTEM_NUMBER_CACHE_H
+
+#include "Qentem/MemoryUtils.hpp"
+#include "Qentem/Digit.hpp"
+
+namespace Qentem {
+
+template <typename Char_T>
+struct NumberCache {
+    static constexpr SizeT32 Size{QENTEM_NUMBER_CACHE_SIZE};
+    static constexpr SizeT32 MaxLength{24U}; ///< Longer outputs are written but not cached.
+    static constexpr bool    IsEnabled{Size != 0};
+
+    static_assert((Size & (Size - 1U)) == 0, "QENTEM_NUMBER_CACHE_SIZE must be a power of two.");
+
+    /**
+     * @brief Writes a double to the stream, formatted with format_info.
+     *
+     * Stream_T must expose First() and Length(), as the text is captured from the stream after a miss.
+     */
+    template <typename Stream_T>
+    static void Write(Stream_T &stream, double number, const Digit::RealFormatInfo &format_info) {
+        if constexpr (IsEnabled) {
+            const SizeT64 bits  = QNumber64{number}.Natural;
+            Entry        &entry = entries_[index(bits, format_info)];
+
+            if ((entry.Length != 0) && (entry.Bits == bits) && (entry.Precision == format_info.Precision) &&
+                (entry.Type == format_info.Type)) {
+                stream.Write(&(entry.Text[0]), entry.Length);
+                return;
+            }
+
+            const SizeT start = stream.Length();
+            Digit::NumberToString(stream, number, format_info);
+            const SizeT length = (stream.Length() - start);
+
+            if (length <= MaxLength) {
+                MemoryUtils::CopyTo(&(entry.Text[0]), (stream.First() + start), length);
+                entry.Bits      = bits;
+                entry.Precision = format_info.Precision;
+                entry.Type      = format_info.Type;
+                entry.Length    = static_cast<SizeT8>(length);
+            }
+        } else {
+            Digit::NumberToString(stream, number, format_info);
+        }
+    }
+
+    /**
+     * @brief Empties the calling thread's table.
+     */
+    static void Clear() noexcept {
+        if constexpr (IsEnabled) {
+            SizeT32 i = 0;
+
+            while (i < Size) {
+                entries_[i].Length = 0;
+                ++i;
+            }
+        }
+    }
+
+  private:
+    struct Entry {
+        SizeT64               Bits{0};
+        SizeT32               Precision{0};
+        Digit::RealFormatType Type{Digit::RealFormatType::Default};
+        SizeT8                Length{0}; ///< Zero marks an empty entry; a formatted number is never empty.
+        Char_T                Text[MaxLength]{};
+    };
+
+    static constexpr SizeT32 indexBits() noexcept {
+        SizeT32 bits = 0;
+
+        while ((SizeT32{1} << bits) < Size) {
+            ++bits;
+        }
+
+        return bits;
+    }
+
+    // Fibonacci hashing: the top bits of the product depend on every bit of the key.
+    QENTEM_INLINE static SizeT32 index(SizeT64 bits, const Digit::RealFormatInfo &format_info) noexcept {
+        bits ^= (SizeT64{format_info.Precision} | (SizeT64(format_info.Type) << 32U));
+        bits *= 0x9E3779B97F4A7C15ULL;
+
+        return static_cast<SizeT32>(bits >> (64U - indexBits()));
+    }
+
+    inline static thread_local Entry entries_[IsEnabled ? Size : 1U]{};
+};
+
+} // namespace Qentem
+
+#endif
@@ -316,6 +316,29 @@ struct Platform {
 #endif // _M_X64
     }
 
+    // Reference counting: increments are relaxed; a decrement also orders the accesses before it.
+    QENTEM_INLINE static SizeT32 AtomicIncrement(SizeT32 &value) noexcept {
+        return static_cast<SizeT32>(_InterlockedIncrement(reinterpret_cast<volatile long *>(&value)));
+    }
+
+    QENTEM_INLINE static SizeT32 AtomicDecrement(SizeT32 &value) noexcept {
+        return static_cast<SizeT32>(_InterlockedDecrement(reinterpret_cast<volatile long *>(&value)));
+    }
+
+    QENTEM_INLINE static SizeT32 AtomicLoad(const SizeT32 &value) noexcept {
+        return static_cast<SizeT32>(_InterlockedOr(reinterpret_cast<volatile long *>(const_cast<SizeT32 *>(&value)), 0));
+    }
+
+    // For caches that any thread may fill: the value is written whole or not at all.
+    QENTEM_INLINE static SizeT64 AtomicLoad(const SizeT64 &value) noexcept {
+        return static_cast<SizeT64>(_InterlockedCompareExchange64(
+            reinterpret_cast<volatile long long *>(const_cast<SizeT64 *>(&value)), 0, 0));
+    }
+
+    QENTEM_INLINE static void AtomicStore(SizeT64 &target, SizeT64 value) noexcept {
+        _InterlockedExchange64(reinterpret_cast<volatile long long *>(&target), static_cast<long long>(value));
+    }
+
 #else // _MSC_VER
     QENTEM_INLINE static constexpr SizeT32 PopCount(unsigned int value) {
         return static_cast<SizeT32>(__builtin_popcount(value));
@@ -400,6 +423,28 @@ struct Platform {
             return (taken_size - static_cast<SizeT32>(__builtin_clz(static_cast<SizeT32>(value))));
         }
     }
+
+    // Reference counting: increments are relaxed; a decrement also orders the accesses before it.
+    QENTEM_INLINE static SizeT32 AtomicIncrement(SizeT32 &value) noexcept {
+        return __atomic_add_fetch(&value, SizeT32{1}, __ATOMIC_RELAXED);
+    }
+
+    QENTEM_INLINE static SizeT32 AtomicDecrement(SizeT32 &value) noexcept {
+        return __atomic_sub_fetch(&value, SizeT32{1}, __ATOMIC_ACQ_REL);
+    }
+
+    QENTEM_INLINE static SizeT32 AtomicLoad(const SizeT32 &value) noexcept {
+        return __atomic_load_n(&value, __ATOMIC_ACQUIRE);
+    }
+
+    // For caches that any thread may fill: the value is written whole or not at all.
+    QENTEM_INLINE static SizeT64 AtomicLoad(const SizeT64 &value) noexcept {
+        return __atomic_load_n(&value, __ATOMIC_RELAXED);
+    }
+
+    QENTEM_INLINE static void AtomicStore(SizeT64 &target, SizeT64 value) noexcept {
+        __atomic_store_n(&target, value, __ATOMIC_RELAXED);
+    }
 #endif // _MSC_VER
 
     template <typename Number_T>
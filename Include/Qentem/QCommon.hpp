@@ -121,6 +121,15 @@ namespace Qentem {
 #define QENTEM_TEMPLATE_DOUBLE_FORMAT Digit::RealFormatType::SemiFixed // Default, Fixed, SemiFixed
 #endif
 
+/**
+ * @brief Number of entries in the per-thread cache of formatted doubles (see NumberCache.hpp).
+ *
+ * Must be a power of two; set to 0 to format every number on each render.
+ */
+#ifndef QENTEM_NUMBER_CACHE_SIZE
+#define QENTEM_NUMBER_CACHE_SIZE 128U
+#endif
+
 #if defined(__SIZEOF_INT128__) && !defined(QENTEM_FORCE_FALLBACK_ARITHMETIC)
 #define QENTEM_HAS_INT128
 #endif
@@ -78,6 +78,8 @@ struct QExpression {
     ~QExpression() {
         if (Type == ExpressionType::SubOperation) {
             MemoryUtils::Destruct(&SubExprs);
+        } else if (Type == ExpressionType::Variable) {
+            MemoryUtils::Destruct(&VariableTag);
         }
     }
 
@@ -145,6 +147,8 @@ struct QExpression {
         if (this != &src) {
             if (Type == ExpressionType::SubOperation) {
                 MemoryUtils::Destruct(&SubExprs);
+            } else if (Type == ExpressionType::Variable) {
+                MemoryUtils::Destruct(&VariableTag);
             }
 
             Operation = src.Operation;
@@ -152,12 +156,12 @@ struct QExpression {
 
             switch (src.Type) {
                 case ExpressionType::Variable: {
-                    VariableTag = src.VariableTag;
+                    MemoryUtils::Construct(&VariableTag, QUtility::Move(src.VariableTag));
                     break;
                 }
 
                 case ExpressionType::SubOperation: {
-                    SubExprs = QUtility::Move(src.SubExprs);
+                    MemoryUtils::Construct(&SubExprs, QUtility::Move(src.SubExprs));
                     break;
                 }
 
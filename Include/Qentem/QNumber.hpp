@@ -90,6 +90,35 @@ union QNumber64 {
         return *this;
     }
 
+    /**
+     * @brief The number as an unsigned key that orders as the number of the given type does.
+     *
+     * For radix sorting (QUtility::RadixSort): the sign bit of an integer is flipped; a
+     * negative double has all its bits flipped and a positive one its sign bit. -0.0 takes the
+     * key of 0.0, as they are equal.
+     */
+    QENTEM_INLINE SizeT64 SortKey(const QNumberType type) const noexcept {
+        constexpr SizeT64 sign_bit = (SizeT64{1} << 63U);
+
+        switch (type) {
+            case QNumberType::Integer: {
+                return (Natural ^ sign_bit);
+            }
+
+            case QNumberType::Real: {
+                if (Real == 0) {
+                    return sign_bit;
+                }
+
+                return (((Natural & sign_bit) != 0) ? ~Natural : (Natural | sign_bit));
+            }
+
+            default: {
+                return Natural;
+            }
+        }
+    }
+
     SizeT64  Natural{0};
     SizeT64I Integer;
     double   Real;
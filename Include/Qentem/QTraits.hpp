@@ -125,6 +125,16 @@ struct IsRValueReference<Type_T &&> {
     static constexpr bool Value{true};
 };
 
+template <typename, typename>
+struct IsSame {
+    static constexpr bool Value{false};
+};
+
+template <typename Type_T>
+struct IsSame<Type_T, Type_T> {
+    static constexpr bool Value{true};
+};
+
 template <typename Type_T>
 struct IsNumber {
     static constexpr bool value = false;
@@ -9,6 +9,9 @@
  * - Move(x): Emulates std::move for manual rvalue casts
  * - Swap(a, b): Value-swapping
  * - Sort<Ascend>(arr, start, end): Simple in-place quick-partition sort
+ * - MergeSort<Ascend>(items, buffer, count): Stable merge sort of entries by their Key
+ * - RadixSort(items, buffer, count): Stable radix sort of entries by an unsigned Key
+ * - SortEntries(items, buffer, count, ascend): Stable sort of SortEntry items, radix or merge by Key type
  *
  * @copyright Copyright (c) 2026 Hani Ammar
  * @license MIT
@@ -137,6 +140,187 @@ struct QUtility {
             Sort<Ascend_T>(arr, index, end);
         }
     }
+
+    /**
+     * @brief Merges the sorted runs [left, middle) and [middle, end) of from into to.
+     *
+     * Entries are compared by their Key member; on equal keys the left one goes first.
+     */
+    template <bool Ascend_T, typename Entry_T, typename Number_T>
+    QENTEM_INLINE static void MergeRuns(const Entry_T *from, Entry_T *to, Number_T left, Number_T middle,
+                                        Number_T end) noexcept {
+        Number_T right = middle;
+        Number_T index = left;
+
+        while ((left < middle) && (right < end)) {
+            // Taking the left one unless the right one is strictly before it keeps the sort stable.
+            bool take_right;
+
+            if constexpr (Ascend_T) {
+                take_right = (from[right].Key < from[left].Key);
+            } else {
+                take_right = (from[left].Key < from[right].Key);
+            }
+
+            to[index] = (take_right ? from[right++] : from[left++]);
+            ++index;
+        }
+
+        while (left < middle) {
+            to[index] = from[left++];
+            ++index;
+        }
+
+        while (right < end) {
+            to[index] = from[right++];
+            ++index;
+        }
+    }
+
+    /**
+     * @brief Bottom-up merge sort of entries by their Key member; equal keys keep their order.
+     *
+     * Unlike Sort(), it takes O(n log n) compares on any input, sorted input included, and
+     * does not recurse. buffer must hold count entries.
+     *
+     * @return items or buffer, whichever ended up holding the sorted entries.
+     */
+    template <bool Ascend_T, typename Entry_T, typename Number_T>
+    static Entry_T *MergeSort(Entry_T *items, Entry_T *buffer, Number_T count) noexcept {
+        for (Number_T width = 1; width < count; width *= Number_T{2}) {
+            Number_T start = 0;
+
+            while (start < count) {
+                const Number_T middle = (((count - start) > width) ? (start + width) : count);
+                const Number_T end    = (((count - middle) > width) ? (middle + width) : count);
+
+                MergeRuns<Ascend_T>(items, buffer, start, middle, end);
+                start = end;
+            }
+
+            Entry_T *swap = items;
+            items         = buffer;
+            buffer        = swap;
+        }
+
+        return items;
+    }
+
+    /**
+     * @brief LSD radix sort of entries by their unsigned Key, a byte per pass, in ascending order.
+     *
+     * No keys are compared: the bytes of every key are counted in one pass, and each byte then
+     * places the entries in another; a byte that all keys share is skipped. Stable, so sorting
+     * complemented keys (~key) gives descending order. buffer must hold count entries.
+     *
+     * @return items or buffer, whichever ended up holding the sorted entries.
+     */
+    template <typename Entry_T, typename Number_T>
+    static Entry_T *RadixSort(Entry_T *items, Entry_T *buffer, Number_T count) noexcept {
+        using Key_T = decltype(items->Key);
+
+        constexpr unsigned int bytes = sizeof(Key_T);
+        Number_T               counts[bytes][256];
+        unsigned int           byte;
+
+        if (count < Number_T{2}) {
+            return items;
+        }
+
+        for (byte = 0; byte < bytes; byte++) {
+            for (unsigned int digit = 0; digit < 256U; digit++) {
+                counts[byte][digit] = 0;
+            }
+        }
+
+        for (Number_T index = 0; index < count; index++) {
+            const Key_T key = items[index].Key;
+
+            for (byte = 0; byte < bytes; byte++) {
+                ++(counts[byte][(key >> (byte * 8U)) & Key_T{0xFF}]);
+            }
+        }
+
+        for (byte = 0; byte < bytes; byte++) {
+            const unsigned int shift    = (byte * 8U);
+            Number_T          *count_of = counts[byte];
+
+            if (count_of[(items[0].Key >> shift) & Key_T{0xFF}] != count) {
+                Number_T offset = 0;
+
+                for (unsigned int digit = 0; digit < 256U; digit++) {
+                    const Number_T digit_count = count_of[digit];
+                    count_of[digit]            = offset;
+                    offset += digit_count;
+                }
+
+                for (Number_T index = 0; index < count; index++) {
+                    buffer[count_of[(items[index].Key >> shift) & Key_T{0xFF}]++] = items[index];
+                }
+
+                Entry_T *swap = items;
+                items         = buffer;
+                buffer        = swap;
+            }
+        }
+
+        return items;
+    }
+
+    /**
+     * @brief A sort key and the position of the item it was taken from.
+     *
+     * Sorting these instead of the items reads the keys from one contiguous array and moves
+     * small entries; the sorted Index values then give the new order of the items.
+     */
+    template <typename Key_T, typename Number_T>
+    struct SortEntry {
+        Key_T    Key;
+        Number_T Index;
+    };
+
+    /**
+     * @brief A key that compares the item it points to, so entries for any type stay small.
+     */
+    template <typename Type_T>
+    struct SortRef {
+        const Type_T *Data;
+
+        QENTEM_INLINE bool operator<(const SortRef &other) const noexcept {
+            return (*Data < *(other.Data));
+        }
+    };
+
+    /**
+     * @brief Stable sort of entries by their Key; equal keys keep their order either way.
+     *
+     * Unsigned integer keys are radix sorted, complemented first for descending order; any
+     * other key is merge sorted with its operator<. buffer must hold count entries.
+     *
+     * @return items or buffer, whichever ended up holding the sorted entries.
+     */
+    template <typename Entry_T, typename Number_T>
+    static Entry_T *SortEntries(Entry_T *items, Entry_T *buffer, Number_T count, bool ascend) noexcept {
+        using Key_T = decltype(items->Key);
+
+        if constexpr (QTraits::IsNumber<Key_T>::value) {
+            static_assert(Key_T(-1) > Key_T{0}, "SortEntries(): numeric keys must be unsigned.");
+
+            if (!ascend) {
+                for (Number_T index = 0; index < count; index++) {
+                    items[index].Key = Key_T(~(items[index].Key));
+                }
+            }
+
+            return RadixSort(items, buffer, count);
+        } else {
+            if (ascend) {
+                return MergeSort<true>(items, buffer, count);
+            }
+
+            return MergeSort<false>(items, buffer, count);
+        }
+    }
 };
 
 } // namespace Qentem
@@ -28,23 +28,28 @@ namespace Qentem {
  * Provides an efficient, minimal-overhead abstraction for managing character sequences
  * with built-in memory allocation and resizing. Suitable for use across template engines,
  * parsers, and data serializers where performance and correctness are paramount.
+ *
+ * Strings of up to InlineCapacity characters are kept inside the object itself, in the
+ * bytes that otherwise hold the storage pointer and the capacity, so they need no
+ * allocation. The top bit of the length marks such a string, which limits the length of
+ * any string to half the range of SizeT.
  */
 template <typename Char_T>
 struct String {
     using CharType = Char_T;
 
+    static constexpr SizeT InlineCapacity{((sizeof(Char_T *) + sizeof(SizeT)) / sizeof(Char_T)) - SizeT{1}};
+
     QENTEM_INLINE String() noexcept = default;
 
     explicit String(SizeT capacity) {
         if (capacity != 0) {
-            reserve(capacity);
+            expand(capacity);
         }
     }
 
-    String(String &&src) noexcept : storage_{src.Storage()}, capacity_{src.Capacity()}, length_{src.Length()} {
-        src.clearStorage();
-        src.setCapacity(0);
-        src.setLength(0);
+    String(String &&src) noexcept : data_{src.data_} {
+        src.data_ = Data{};
     }
 
     String(const String &src) {
@@ -62,20 +67,15 @@ struct String {
     }
 
     QENTEM_INLINE ~String() {
-        release(Storage(), Capacity());
+        release();
     }
 
     String &operator=(String &&src) noexcept {
         if (this != &src) {
-            release(Storage(), Capacity());
+            release();
 
-            setStorage(src.Storage());
-            setCapacity(src.Capacity());
-            setLength(src.Length());
-
-            src.clearStorage();
-            src.setCapacity(0);
-            src.setLength(0);
+            data_     = src.data_;
+            src.data_ = Data{};
         }
 
         return *this;
@@ -142,9 +142,17 @@ struct String {
         return merge(First(), Length(), str, StringUtils::Count(str));
     }
 
+    // Writes Length() characters; a borrowed string (see Borrow()) is not null-terminated.
     template <typename Stream_T>
     QENTEM_INLINE friend Stream_T &operator<<(Stream_T &out, const String &string) {
-        out << string.First();
+        const Char_T *str = string.First();
+        SizeT         index{0};
+
+        while (index < string.Length()) {
+            out << str[index];
+            ++index;
+        }
+
         return out;
     }
 
@@ -237,11 +245,11 @@ struct String {
     void Write(Char_T ch) {
         const SizeT new_length = (Length() + SizeT{1});
 
-        if (Capacity() == Length()) {
+        if (Capacity() <= Length()) {
             expand(new_length);
         }
 
-        Storage()[Length()] = ch;
+        storage()[Length()] = ch;
         setLength(new_length);
     }
 
@@ -253,16 +261,19 @@ struct String {
                 expand(new_length);
             }
 
-            MemoryUtils::CopyTo((Storage() + Length()), str, length);
+            Char_T *des = storage();
+
+            MemoryUtils::CopyTo((des + Length()), str, length);
 
-            Storage()[new_length] = Char_T{0};
+            des[new_length] = Char_T{0};
             setLength(new_length);
         }
     }
 
     QENTEM_INLINE void WriteAt(const SizeT index, const Char_T *str, const SizeT length) {
         if ((index + length) <= Length()) {
-            MemoryUtils::CopyTo((Storage() + index), str, length);
+            own();
+            MemoryUtils::CopyTo((storage() + index), str, length);
         }
     }
 
@@ -294,10 +305,11 @@ struct String {
 
             if (capacity > Capacity()) {
                 expand(capacity);
-            } else if ((capacity < Capacity()) && Reserver::Shrink(Storage(), Capacity(), capacity)) {
+            } else if (isOwned() && (capacity < Capacity()) &&
+                       Reserver::Shrink(storage(), (Capacity() + SizeT{1}), (capacity + SizeT{1}))) {
                 capacity = static_cast<SizeT>(Reserver::RoundUpBytes<Char_T>(capacity + SizeT{1}) / sizeof(Char_T));
                 --capacity;
-                setCapacity(capacity);
+                data_.Heap.Capacity = capacity;
             }
         } else {
             Reset();
@@ -307,9 +319,11 @@ struct String {
     QENTEM_INLINE void SetLength(SizeT length) {
         if (Capacity() < length) {
             expand(length);
+        } else {
+            own();
         }
 
-        Storage()[length] = Char_T{0};
+        storage()[length] = Char_T{0};
         setLength(length);
     }
 
@@ -318,11 +332,8 @@ struct String {
     }
 
     void Reset() noexcept {
-        release(Storage(), Capacity());
-
-        clearStorage();
-        setCapacity(0);
-        setLength(0);
+        release();
+        data_ = Data{};
     }
 
     // Returns view without null-terminator.
@@ -335,11 +346,20 @@ struct String {
         return StringView<Char_T>{First(), Length()};
     }
 
-    Char_T *Detach() noexcept {
-        Char_T *str = Storage();
-        clearStorage();
-        setCapacity(0);
-        setLength(0);
+    /**
+     * @brief Hands the storage over to the caller, who releases it with Capacity() + 1.
+     *
+     * An inline string is first moved to a reservation of its own, sized by InlineCapacity.
+     */
+    Char_T *Detach() {
+        own();
+
+        if (isInline()) {
+            toHeap(InlineCapacity);
+        }
+
+        Char_T *str = data_.Heap.Storage;
+        data_       = Data{};
 
         return str;
     }
@@ -356,23 +376,48 @@ struct String {
      */
     void Adopt(Char_T *str, SizeT length, SizeT capacity_without_null) {
         // Release any previously owned memory
-        release(Storage(), Capacity());
+        release();
 
-        setStorage(str);
-        setCapacity(capacity_without_null);
-        setLength(length);
-        Storage()[length] = Char_T{0};
+        data_.Heap.Storage  = str;
+        data_.Heap.Capacity = capacity_without_null;
+        data_.Heap.Length   = length;
+        str[length]         = Char_T{0};
     }
 
-    QENTEM_INLINE void StepBack(const SizeT length) noexcept {
+    /**
+     * @brief Refers to an existing buffer instead of copying it.
+     *
+     * The buffer is neither copied nor released, so it must outlive the string and stay
+     * unchanged. A borrowed string is not null-terminated; anything that modifies it first
+     * copies the text into storage of its own. Copying a borrowed string also copies the text.
+     *
+     * @param str    Pointer to the characters to refer to.
+     * @param length Number of characters.
+     */
+    void Borrow(const Char_T *str, SizeT length) noexcept {
+        release();
+
+        data_.Heap.Storage  = const_cast<Char_T *>(str);
+        data_.Heap.Capacity = 0;
+        data_.Heap.Length   = length;
+    }
+
+    // Owned storage always has room for at least one character, so no capacity means borrowed.
+    QENTEM_INLINE bool IsBorrowed() const noexcept {
+        return ((Capacity() == 0) && (First() != nullptr));
+    }
+
+    QENTEM_INLINE void StepBack(const SizeT length) {
         if (length <= Length()) {
-            length_ -= length;
-            Storage()[Length()] = Char_T{0};
+            own();
+            setLength(Length() - length);
+            storage()[Length()] = Char_T{0};
         }
     }
 
-    QENTEM_INLINE void Reverse(SizeT start = 0) noexcept {
-        StringUtils::Reverse(Storage(), start, Length());
+    QENTEM_INLINE void Reverse(SizeT start = 0) {
+        own();
+        StringUtils::Reverse(storage(), start, Length());
     }
 
     /**
@@ -390,11 +435,14 @@ struct String {
 
         if (Capacity() < new_length) {
             expand(new_length);
+        } else {
+            own();
         }
 
-        Char_T *str = (Storage() + Length());
+        Char_T *des = storage();
+        Char_T *str = (des + Length());
 
-        Storage()[new_length] = Char_T{0};
+        des[new_length] = Char_T{0};
         setLength(new_length);
 
         return str;
@@ -409,27 +457,33 @@ struct String {
         return String((str + offset), length);
     }
 
-    QENTEM_INLINE Char_T *Storage() noexcept {
-        return storage_;
+    // A borrowed string (see Borrow()) is copied first, as the caller may write through it.
+    QENTEM_INLINE Char_T *Storage() {
+        own();
+        return storage();
     }
 
     QENTEM_INLINE const Char_T *Storage() const noexcept {
-        return storage_;
+        return First();
     }
 
     QENTEM_INLINE SizeT Length() const noexcept {
-        return length_;
+        return (data_.Heap.Length & ~InlineFlag);
     }
 
     QENTEM_INLINE SizeT Capacity() const noexcept {
-        return capacity_;
+        return isInline() ? InlineCapacity : data_.Heap.Capacity;
     }
 
     QENTEM_INLINE const Char_T *First() const noexcept {
-        return storage_;
+        return isInline() ? &(data_.Inline.Storage[0]) : data_.Heap.Storage;
     }
 
-    QENTEM_INLINE Char_T *Last() noexcept {
+    QENTEM_INLINE bool IsInline() const noexcept {
+        return isInline();
+    }
+
+    QENTEM_INLINE Char_T *Last() {
         if (IsNotEmpty()) {
             return (Storage() + (Length() - SizeT{1}));
         }
@@ -466,29 +520,50 @@ struct String {
         return End();
     }
 
-    QENTEM_INLINE Char_T *begin() noexcept {
+    QENTEM_INLINE Char_T *begin() {
         return Storage();
     }
 
-    QENTEM_INLINE Char_T *end() noexcept {
+    QENTEM_INLINE Char_T *end() {
         return (Storage() + Length());
     }
 
   private:
-    QENTEM_INLINE void setStorage(Char_T *new_storage) noexcept {
-        storage_ = new_storage;
+    static constexpr SizeT InlineFlag{SizeT{1} << ((sizeof(SizeT) * 8U) - 1U)};
+
+    // Both layouts end with the length, so it is read the same way in either.
+    struct HeapData {
+        Char_T *Storage;
+        SizeT   Capacity;
+        SizeT   Length;
+    };
+
+    struct InlineData {
+        Char_T Storage[InlineCapacity + SizeT{1}];
+        SizeT  Length;
+    };
+
+    union Data {
+        HeapData   Heap;
+        InlineData Inline;
+    };
+
+    static_assert(sizeof(HeapData) == sizeof(InlineData), "Inline storage must overlay the heap fields exactly.");
+
+    QENTEM_INLINE Char_T *storage() noexcept {
+        return isInline() ? &(data_.Inline.Storage[0]) : data_.Heap.Storage;
     }
 
-    QENTEM_INLINE void clearStorage() noexcept {
-        setStorage(nullptr);
+    QENTEM_INLINE bool isInline() const noexcept {
+        return ((data_.Heap.Length & InlineFlag) != 0);
     }
 
-    QENTEM_INLINE void setLength(const SizeT new_length) noexcept {
-        length_ = new_length;
+    QENTEM_INLINE bool isOwned() const noexcept {
+        return (!isInline() && (data_.Heap.Capacity != 0));
     }
 
-    QENTEM_INLINE void setCapacity(const SizeT new_capacity) noexcept {
-        capacity_ = new_capacity;
+    QENTEM_INLINE void setLength(const SizeT new_length) noexcept {
+        data_.Heap.Length = (new_length | (data_.Heap.Length & InlineFlag));
     }
 
     static String merge(const Char_T *str1, const SizeT len1, const Char_T *str2, const SizeT len2) {
@@ -496,7 +571,7 @@ struct String {
         String      ns{length};
         ns.setLength(length);
 
-        Char_T *des = ns.Storage();
+        Char_T *des = ns.storage();
 
         if (len1 != 0) {
             MemoryUtils::CopyTo(des, str1, len1);
@@ -511,39 +586,68 @@ struct String {
         return ns;
     }
 
+    // Gives a borrowed string storage of its own before it gets modified.
+    QENTEM_INLINE void own() {
+        if (IsBorrowed()) {
+            expand(Length());
+            storage()[Length()] = Char_T{0};
+        }
+    }
+
     QENTEM_NOINLINE void expand(SizeT new_capacity) {
-        if (Reserver::TryExpand(Storage(), Capacity(), new_capacity + SizeT{1})) {
+        if (isOwned() && Reserver::TryExpand(storage(), (Capacity() + SizeT{1}), (new_capacity + SizeT{1}))) {
             new_capacity = static_cast<SizeT>(Reserver::RoundUpBytes<Char_T>(new_capacity + SizeT{1}) / sizeof(Char_T));
             --new_capacity;
-            setCapacity(new_capacity);
+            data_.Heap.Capacity = new_capacity;
             return;
         }
 
-        Char_T *old_storage  = Storage();
-        SizeT   old_capacity = Capacity();
+        // Only an empty, borrowed or adopted string can be smaller than the inline storage.
+        if (new_capacity <= InlineCapacity) {
+            const SizeT length = ((Length() < new_capacity) ? Length() : new_capacity);
+            Data        data{};
+
+            if (length != 0) {
+                MemoryUtils::CopyTo(&(data.Inline.Storage[0]), First(), length);
+            }
 
-        reserve(new_capacity);
+            data.Inline.Storage[length] = Char_T{0};
+            data.Inline.Length          = (length | InlineFlag);
 
-        if (old_storage != nullptr) {
-            MemoryUtils::CopyTo(Storage(), old_storage, Length());
-            release(old_storage, old_capacity);
+            release();
+            data_ = data;
+        } else {
+            toHeap(new_capacity);
         }
     }
 
-    void reserve(SizeT capacity) {
-        capacity = static_cast<SizeT>(Reserver::RoundUpBytes<Char_T>(capacity + SizeT{1}) / sizeof(Char_T));
-        setStorage(Reserver::Reserve<Char_T>(capacity));
-        --capacity;
-        setCapacity(capacity);
+    // A borrowed string being shortened may hold more than the new capacity.
+    void toHeap(SizeT capacity) {
+        const SizeT length = ((Length() < capacity) ? Length() : capacity);
+        Data        data{};
+
+        capacity           = static_cast<SizeT>(Reserver::RoundUpBytes<Char_T>(capacity + SizeT{1}) / sizeof(Char_T));
+        data.Heap.Storage  = Reserver::Reserve<Char_T>(capacity);
+        data.Heap.Capacity = (capacity - SizeT{1});
+        data.Heap.Length   = length;
+
+        if (length != 0) {
+            MemoryUtils::CopyTo(data.Heap.Storage, First(), length);
+        }
+
+        data.Heap.Storage[length] = Char_T{0};
+
+        release();
+        data_ = data;
     }
 
-    QENTEM_INLINE static void release(Char_T *storage, SizeT capacity) {
-        Reserver::Release(storage, (capacity + SizeT{1}));
+    QENTEM_INLINE void release() noexcept {
+        if (isOwned()) {
+            Reserver::Release(data_.Heap.Storage, (data_.Heap.Capacity + SizeT{1}));
+        }
     }
 
-    Char_T *storage_{nullptr};
-    SizeT   capacity_{0};
-    SizeT   length_{0};
+    Data data_{};
 };
 
 } // namespace Qentem
@@ -64,6 +64,7 @@ struct StringStream : public StringStreamBase<Char_T, MemoryProvider_T> {
     using BaseT::First;
     using BaseT::InsertNull;
     using BaseT::Length;
+    using BaseT::Reset;
     using BaseT::shrink;
     using BaseT::Storage;
     using BaseT::Write;
@@ -100,6 +101,12 @@ struct StringStream : public StringStreamBase<Char_T, MemoryProvider_T> {
         String<Char_T> new_str{};
         const SizeT    length = Length(); // Detach() resets Length.
 
+        // A String with storage but no capacity is a borrowed one, which is never released.
+        if (length == 0) {
+            Reset();
+            return new_str;
+        }
+
         if (Capacity() > Length()) {
             SizeT new_capacity = (Length() + SizeT{1});
             shrink(Storage(), Capacity(), new_capacity);
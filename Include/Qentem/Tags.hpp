@@ -74,12 +74,13 @@ struct LoopTag {
     Array<TagBit> SubTags;
     VariableTag   Set{};
 
-    const LoopTag *Parent{nullptr};
+    LoopTag *Parent{nullptr};
 
     SizeT Offset{0};
     SizeT EndOffset{0};
 
     SizeT16 ContentOffset{0};
+    SizeT16 HoistedCount{0}; // Invariant variables of inner loops cached per run of this loop.
 
     SizeT8 ValueOffset{0};
     SizeT8 ValueLength{0};
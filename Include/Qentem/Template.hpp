@@ -19,7 +19,11 @@
 
 #include "Qentem/PatternFinder.hpp"
 #include "Qentem/Digit.hpp"
+#include "Qentem/NumberCache.hpp"
 #include "Qentem/Tags.hpp"
+#include "Qentem/MessageBundle.hpp"
+#include "Qentem/StringStream.hpp"
+#include "Qentem/Unicode.hpp"
 #include "Qentem/StringView.hpp"
 #include "Qentem/QConsole.hpp"
 
@@ -202,6 +206,21 @@ namespace Qentem {
 template <typename, typename, typename>
 struct TemplateCore;
 
+template <typename>
+struct Value;
+
+/**
+ * @brief A UTF-16/UTF-32 template transcoded to UTF-8 once, together with its parsed tags.
+ *
+ * Rendering a UTF8Template runs every byte-oriented path (PatternFinder, HTML escaping,
+ * number formatting) over UTF-8 and only widens the final output when the target stream is wide.
+ * Built by Template::ToUTF8(); values passed to its Render() are `char` based.
+ */
+struct UTF8Template {
+    StringStream<char>  Content{};
+    Array<Tags::TagBit> Tags{};
+};
+
 template <typename>
 struct QOperationSymbols_T;
 
@@ -258,6 +277,37 @@ struct Template {
     QENTEM_INLINE static StringStream_T Render(const Char_T *content, const Value_T &value) {
         return Render<StringStream_T>(content, StringUtils::Count(content), value);
     }
+
+    template <typename Char_T, typename Value_T = Value<char>>
+    static void ToUTF8(const Char_T *content, const SizeT length, UTF8Template &utf8_template) {
+        utf8_template.Content.Clear();
+        utf8_template.Tags.Reset();
+
+        Unicode::ToUTF8(content, length, utf8_template.Content);
+        TemplateCore<char, Value_T, StringStream<char>>::Parse(utf8_template.Content.First(),
+                                                               utf8_template.Content.Length(), utf8_template.Tags);
+    }
+
+    template <typename Value_T, typename StringStream_T>
+    static StringStream_T &Render(const UTF8Template &utf8_template, const Value_T &value, StringStream_T &stream) {
+        using Char_T = typename StringStream_T::CharType;
+
+        const char *content = utf8_template.Content.First();
+        const SizeT length  = utf8_template.Content.Length();
+
+        if constexpr (QTraits::IsSame<Char_T, char>::Value) {
+            TemplateCore<char, Value_T, StringStream_T> temp{content, length};
+            temp.Render(utf8_template.Tags, value, stream);
+        } else {
+            StringStream<char>                              utf8_stream{};
+            TemplateCore<char, Value_T, StringStream<char>> temp{content, length};
+
+            temp.Render(utf8_template.Tags, value, utf8_stream);
+            Unicode::FromUTF8<Char_T>(utf8_stream.First(), utf8_stream.Length(), stream);
+        }
+
+        return stream;
+    }
 };
 
 template <typename Char_T, typename Value_T, typename StringStream_T>
@@ -284,9 +334,15 @@ struct TemplateCore {
     using ExpressionType   = QExpression::ExpressionType;
     using TagPatterns      = Tags::TagPatterns_T<Char_T>;
 
+    struct HoistedValue {
+        const Value_T *Value{nullptr};
+        bool           Resolved{false};
+    };
+
     struct LoopItem {
-        const Value_T     *Value{nullptr};
-        StringView<Char_T> Key{};
+        const Value_T      *Value{nullptr};
+        StringView<Char_T>  Key{};
+        Array<HoistedValue> Hoisted{};
     };
 
   public:
@@ -294,6 +350,11 @@ struct TemplateCore {
         format_info_ = Digit::RealFormatInfo{precision, type};
     }
 
+    // Renders {svar:...} from pre-compiled messages; ids missing from the bundle fall back to the value.
+    QENTEM_INLINE void SetMessageBundle(const MessageBundle<Char_T> *bundle) noexcept {
+        bundle_ = bundle;
+    }
+
     QENTEM_INLINE void Parse(Array<TagBit> &tags_cache) const {
         parse(content_, length_, tags_cache);
     }
@@ -333,7 +394,7 @@ struct TemplateCore {
 
         Array<Array<TagBit> *> parent_storage{SizeT{8}};
         Array<TagBit>         *storage{&tags_cache};
-        const LoopTag         *loop_tag{nullptr};
+        LoopTag               *loop_tag{nullptr};
 
         SizeT32 match;
         bool    is_child{false};
@@ -690,8 +751,9 @@ struct TemplateCore {
                         LoopTag *tag = (storage->Insert(TagBit{})).MakeLoopTag();
                         tag->Offset  = loop_offset;
                         tag->Parent  = loop_tag;
-                        tag->Level   = static_cast<SizeT8>(parent_storage.Size());
-                        loop_tag     = tag;
+                        // Loop depth, not tag depth: <if> and inline tags between loops do not take a slot.
+                        tag->Level = (loop_tag != nullptr) ? static_cast<SizeT8>(loop_tag->Level + 1) : SizeT8{0};
+                        loop_tag   = tag;
 
                         parseLoopAttributes(content, offset, *tag);
 
@@ -849,8 +911,9 @@ struct TemplateCore {
         }
     }
 
-    static void parseVariable(const Char_T *content, VariableTag &tag, const LoopTag *loop_tag) noexcept {
+    static void parseVariable(const Char_T *content, VariableTag &tag, LoopTag *loop_tag) noexcept {
         const Char_T *id        = (content + tag.Info.Offset);
+        LoopTag      *inner     = loop_tag;
         SizeT         offset    = 0;
         SizeT         length    = static_cast<SizeT>(tag.Length);
         const bool    has_index = ((length != 0) && (id[(length - SizeT{1})] == TagPatterns::VariableIndexSuffix));
@@ -875,6 +938,7 @@ struct TemplateCore {
             loop_tag = loop_tag->Parent;
         }
 
+        hoistVariable(tag, inner);
         tag.Count = 1;
 
         if (!has_index) {
@@ -931,6 +995,16 @@ struct TemplateCore {
                 offset  = start_offset;
                 offset2 = offset;
 
+                if (tag.IDLength != 0) {
+                    // The first index of a loop variable is already in list[0].
+                    while (id[offset2] != TagPatterns::VariableIndexSuffix) {
+                        ++offset2;
+                    }
+
+                    offset2 += SizeT{2}; // The char after ][
+                    offset = offset2;
+                }
+
                 while ((offset2 < tag.Length)) {
                     while ((offset2 < tag.Length) && (id[offset2] != TagPatterns::VariableIndexSuffix)) {
                         ++offset2;
@@ -953,6 +1027,25 @@ struct TemplateCore {
         }
     }
 
+    // A variable that does not depend on the innermost loop resolves to the same value on every iteration of it.
+    // It gets a slot in the cache of the loop right below its scope, which is cleared each time that loop starts.
+    static void hoistVariable(VariableTag &tag, LoopTag *loop_tag) noexcept {
+        if (loop_tag != nullptr) {
+            const SizeT8 level = ((tag.IDLength != 0) ? static_cast<SizeT8>(tag.Level + 1) : SizeT8{0});
+
+            if (loop_tag->Level >= level) {
+                while (loop_tag->Level != level) {
+                    loop_tag = loop_tag->Parent;
+                }
+
+                if (loop_tag->HoistedCount != SizeT16(~SizeT16{0})) {
+                    ++(loop_tag->HoistedCount);
+                    tag.HoistID = loop_tag->HoistedCount;
+                }
+            }
+        }
+    }
+
     static void parseLoopAttributes(const Char_T *content, const SizeT end_offset, LoopTag &tag) noexcept {
         enum struct LoopAttributes : SizeT8 { None = 0, Set, Value, Sort, Group };
         SizeT offset = (tag.Offset + TagPatterns::LoopPrefixLength);
@@ -1140,6 +1233,13 @@ struct TemplateCore {
 
         const Value_T *value = getValue(tag);
 
+        if constexpr (NumberCache<Char_T>::IsEnabled) {
+            if ((value != nullptr) && value->IsDouble()) {
+                NumberCache<Char_T>::Write(*stream_, value->GetDouble(), format_info_);
+                return;
+            }
+        }
+
         if ((value == nullptr) ||
             !(value->CopyValueTo(*stream_, format_info_,
                                  &(StringUtils::EscapeHTMLSpecialChars<StringStream_T, Char_T>)))) {
@@ -1168,6 +1268,13 @@ struct TemplateCore {
 
         const Value_T *value = getValue(tag);
 
+        if constexpr (NumberCache<Char_T>::IsEnabled) {
+            if ((value != nullptr) && value->IsDouble()) {
+                NumberCache<Char_T>::Write(*stream_, value->GetDouble(), format_info_);
+                return;
+            }
+        }
+
         if ((value == nullptr) || !(value->CopyValueTo(*stream_, format_info_))) {
             stream_->Write((content_ + t_offset), length);
         }
@@ -1194,7 +1301,7 @@ struct TemplateCore {
                 }
 
                 case ExpressionType::RealNumber: {
-                    Digit::NumberToString(*stream_, result.ExprValue.Number.Real, format_info_);
+                    NumberCache<Char_T>::Write(*stream_, result.ExprValue.Number.Real, format_info_);
                     break;
                 }
 
@@ -1208,80 +1315,111 @@ struct TemplateCore {
 
     void renderSuperVariable(const TagBit *tagbit, SizeT &offset) const {
         const SuperVariableTag &tag     = tagbit->GetSuperVariableTag();
-        const Value_T          *s_var   = getValue(tag.Variable);
         const Char_T           *content = nullptr;
         SizeT                   length  = 0;
 
         stream_->Write((content_ + offset), (tag.Offset - offset));
         offset = tag.EndOffset;
 
-        if ((s_var != nullptr) && s_var->SetCharAndLength(content, length)) {
-            SizeT index      = 0;
-            SizeT last_index = 0;
-
-            while (index < length) {
-                if (content[index] == TagPatterns::InLineFirstChar) {
-                    const SizeT start = index;
-
-                    StringUtils::EscapeHTMLSpecialChars(*stream_, (content + last_index), (start - last_index));
-                    last_index = start;
-                    ++index;
+        if (bundle_ != nullptr) {
+            const VariableTag           &var        = tag.Variable;
+            const SizeT                  var_offset = ((var.Count <= SizeT8{1}) ? var.Info.Offset : var.List[0].Offset);
+            const MessageFormat<Char_T> *message    = bundle_->Find((content_ + var_offset), var.Length);
+
+            if (message != nullptr) {
+                if (message->Arguments <= tag.SubTags.Size()) {
+                    const MessageSegment *segment = message->Segments.First();
+                    const MessageSegment *last    = message->Segments.Last();
+                    const Char_T         *text    = message->Text.First();
+
+                    while (segment < last) {
+                        stream_->Write((text + segment->Offset), segment->Length);
+                        renderSuperVariableArgument((tag.SubTags.First() + segment->Index));
+                        ++segment;
+                    }
 
-                    if (index < length) {
-                        const SizeT id = static_cast<SizeT>(content[index] - DigitUtils::DigitChar::Zero);
-                        ++index;
+                    stream_->Write((text + last->Offset), last->Length);
+                } else {
+                    renderSuperVariableFormat(tag, message->Format.First(), message->Format.Length());
+                }
 
-                        if ((index < length) && (content[index] == TagPatterns::InLineLastChar)) {
-                            ++index;
+                return;
+            }
+        }
 
-                            if (id < tag.SubTags.Size()) {
-                                const TagBit *sub_tag = (tag.SubTags.First() + id);
-                                last_index            = index;
+        const Value_T *s_var = getValue(tag.Variable);
 
-                                switch (sub_tag->GetType()) {
-                                    case TagType::Variable: {
-                                        const VariableTag &var = sub_tag->GetVariableTag();
-                                        SizeT              var_offset =
-                                            (((var.Count <= SizeT8{1}) ? var.Info.Offset : var.List[0].Offset) -
-                                             TagPatterns::VariablePrefixLength);
+        if ((s_var != nullptr) && s_var->SetCharAndLength(content, length)) {
+            renderSuperVariableFormat(tag, content, length);
+        } else {
+            stream_->Write((content_ + tag.Offset), (tag.EndOffset - tag.Offset));
+        }
+    }
 
-                                        renderVariable(sub_tag, var_offset);
-                                        break;
-                                    }
+    void renderSuperVariableFormat(const SuperVariableTag &tag, const Char_T *content, SizeT length) const {
+        SizeT index      = 0;
+        SizeT last_index = 0;
 
-                                    case TagType::RawVariable: {
-                                        const VariableTag &r_var = sub_tag->GetVariableTag();
-                                        SizeT              r_var_offset =
-                                            (((r_var.Count <= SizeT8{1}) ? r_var.Info.Offset : r_var.List[0].Offset) -
-                                             TagPatterns::RawVariablePrefixLength);
+        while (index < length) {
+            if (content[index] == TagPatterns::InLineFirstChar) {
+                const SizeT start = index;
 
-                                        renderRawVariable(sub_tag, r_var_offset);
-                                        break;
-                                    }
+                StringUtils::EscapeHTMLSpecialChars(*stream_, (content + last_index), (start - last_index));
+                last_index = start;
+                ++index;
 
-                                    case TagType::Math: {
-                                        const MathTag &math        = sub_tag->GetMathTag();
-                                        SizeT          math_offset = math.Offset;
-                                        renderMath(sub_tag, math_offset);
-                                        break;
-                                    }
+                if (index < length) {
+                    const SizeT id = static_cast<SizeT>(content[index] - DigitUtils::DigitChar::Zero);
+                    ++index;
 
-                                    default: {
-                                    }
-                                }
+                    if ((index < length) && (content[index] == TagPatterns::InLineLastChar)) {
+                        ++index;
 
-                                continue;
-                            }
+                        if (id < tag.SubTags.Size()) {
+                            last_index = index;
+                            renderSuperVariableArgument((tag.SubTags.First() + id));
+                            continue;
                         }
                     }
                 }
+            }
 
-                ++index;
+            ++index;
+        }
+
+        StringUtils::EscapeHTMLSpecialChars(*stream_, (content + last_index), (index - last_index));
+    }
+
+    void renderSuperVariableArgument(const TagBit *sub_tag) const {
+        switch (sub_tag->GetType()) {
+            case TagType::Variable: {
+                const VariableTag &var = sub_tag->GetVariableTag();
+                SizeT              var_offset = (((var.Count <= SizeT8{1}) ? var.Info.Offset : var.List[0].Offset) -
+                                    TagPatterns::VariablePrefixLength);
+
+                renderVariable(sub_tag, var_offset);
+                break;
             }
 
-            StringUtils::EscapeHTMLSpecialChars(*stream_, (content + last_index), (index - last_index));
-        } else {
-            stream_->Write((content_ + tag.Offset), (tag.EndOffset - tag.Offset));
+            case TagType::RawVariable: {
+                const VariableTag &r_var = sub_tag->GetVariableTag();
+                SizeT              r_var_offset =
+                    (((r_var.Count <= SizeT8{1}) ? r_var.Info.Offset : r_var.List[0].Offset) -
+                     TagPatterns::RawVariablePrefixLength);
+
+                renderRawVariable(sub_tag, r_var_offset);
+                break;
+            }
+
+            case TagType::Math: {
+                const MathTag &math        = sub_tag->GetMathTag();
+                SizeT          math_offset = math.Offset;
+                renderMath(sub_tag, math_offset);
+                break;
+            }
+
+            default: {
+            }
         }
     }
 
@@ -1373,6 +1511,10 @@ struct TemplateCore {
                 *loops_items_ += LoopItem{};
             }
 
+            if (tag.HoistedCount != 0) {
+                loops_items_->Storage()[tag.Level].Hoisted.Reserve(tag.HoistedCount, true);
+            }
+
             if (loop_set->IsObject()) {
                 while (loop_index < loop_size) {
                     LoopItem &item = loops_items_->Storage()[tag.Level];
@@ -1424,6 +1566,22 @@ struct TemplateCore {
     }
 
     const Value_T *getValue(const VariableTag &tag) const noexcept {
+        if (tag.HoistID != 0) {
+            const SizeT   level   = ((tag.IDLength != 0) ? SizeT(tag.Level + SizeT{1}) : SizeT{0});
+            HoistedValue &hoisted = loops_items_->Storage()[level].Hoisted.Storage()[tag.HoistID - SizeT{1}];
+
+            if (!hoisted.Resolved) {
+                hoisted.Value    = findValue(tag);
+                hoisted.Resolved = true;
+            }
+
+            return hoisted.Value;
+        }
+
+        return findValue(tag);
+    }
+
+    const Value_T *findValue(const VariableTag &tag) const noexcept {
         const Value_T      *value    = nullptr;
         const VariableInfo *Info     = ((tag.Count <= SizeT8{1}) ? &(tag.Info) : tag.List);
         const VariableInfo *Info_end = (Info + tag.Count);
@@ -1853,7 +2011,7 @@ struct TemplateCore {
     }
 
     static QExpressions parseExpressions(const Char_T *content, SizeT offset, const SizeT end_offset,
-                                         const LoopTag *loop_tag) {
+                                         LoopTag *loop_tag) {
         QExpressions exprs;
         QOperation   last_oper = QOperation::NoOp;
 
@@ -1887,7 +2045,7 @@ struct TemplateCore {
     }
 
     static bool parseValue(QExpressions &exprs, const QOperation oper, const QOperation last_oper,
-                           const Char_T *content, SizeT offset, SizeT end_offset, const LoopTag *loop_tag) {
+                           const Char_T *content, SizeT offset, SizeT end_offset, LoopTag *loop_tag) {
         using QOperationSymbols = QOperationSymbols_T<Char_T>;
 
         StringUtils::TrimLeft(content, offset, end_offset);
@@ -2137,12 +2295,13 @@ struct TemplateCore {
         return false;
     }
 
-    const Value_T        *value_{nullptr};
-    StringStream_T       *stream_{nullptr};
-    Array<LoopItem>      *loops_items_{nullptr};
-    const Char_T         *content_;
-    const SizeT           length_;
-    Digit::RealFormatInfo format_info_{QentemConfig::TemplatePrecision, QENTEM_TEMPLATE_DOUBLE_FORMAT};
+    const Value_T               *value_{nullptr};
+    StringStream_T              *stream_{nullptr};
+    Array<LoopItem>             *loops_items_{nullptr};
+    const MessageBundle<Char_T> *bundle_{nullptr};
+    const Char_T                *content_;
+    const SizeT                  length_;
+    Digit::RealFormatInfo        format_info_{QentemConfig::TemplatePrecision, QENTEM_TEMPLATE_DOUBLE_FORMAT};
 };
 
 } // namespace Qentem
@@ -11,6 +11,8 @@
  * Note: These functions assume the caller supplies a valid Unicode code point in the range [0, 0x10FFFF].
  *       No runtime validation or error handling for invalid or surrogate code points is performed.
  *
+ * Bulk ToUTF8()/FromUTF8() transcode whole strings between UTF-8 and UTF-16/32.
+ *
  * Example:
  *   Qentem::Unicode::ToUTF<char>(0x10A7B, output);
  *
@@ -94,6 +96,133 @@ struct Unicode {
             stream.Write(Char_T(unicode));
         }
     };
+
+    /**
+     * Transcodes a UTF-8/16/32 string (by the size of Char_T) to UTF-8.
+     *
+     * Runs of ASCII are narrowed through a small local buffer and written in bulk;
+     * only non-ASCII characters are decoded one by one. Unpaired UTF-16 surrogates
+     * are replaced with U+FFFD. A UTF-8 source is copied as-is.
+     */
+    template <typename Char_T, typename Stream_T>
+    static void ToUTF8(const Char_T *str, SizeT length, Stream_T &stream) {
+        using Out_T = typename Stream_T::CharType;
+
+        if constexpr (sizeof(Char_T) == 1U) {
+            stream.Write(reinterpret_cast<const Out_T *>(str), length);
+        } else {
+            constexpr SizeT buffer_size = 64U;
+            Out_T           buffer[buffer_size];
+            SizeT           index{0};
+
+            stream.Expect(length);
+
+            while (index < length) {
+                SizeT count{0};
+
+                while ((index < length) && (count < buffer_size) && (SizeT32(str[index]) < 0x80U)) {
+                    buffer[count] = Out_T(str[index]);
+                    ++count;
+                    ++index;
+                }
+
+                if (count != 0) {
+                    stream.Write(buffer, count);
+                    continue;
+                }
+
+                SizeT32 unicode = SizeT32(str[index]);
+                ++index;
+
+                if constexpr (sizeof(Char_T) == 2U) {
+                    if ((unicode >= 0xD800U) && (unicode <= 0xDFFFU)) {
+                        if ((unicode <= 0xDBFFU) && (index < length) && (SizeT32(str[index]) >= 0xDC00U) &&
+                            (SizeT32(str[index]) <= 0xDFFFU)) {
+                            unicode = (0x10000U + ((unicode - 0xD800U) << 10U) + (SizeT32(str[index]) - 0xDC00U));
+                            ++index;
+                        } else {
+                            unicode = 0xFFFDU;
+                        }
+                    }
+                } else if ((unicode > 0x10FFFFU) || ((unicode >= 0xD800U) && (unicode <= 0xDFFFU))) {
+                    unicode = 0xFFFDU;
+                }
+
+                UnicodeToUTF<Out_T, Stream_T, 1U>::ToUTF(unicode, stream);
+            }
+        }
+    }
+
+    /**
+     * Transcodes a UTF-8 string to UTF-8/16/32 (by the size of Char_T).
+     *
+     * ASCII runs are widened in bulk; malformed or truncated sequences become U+FFFD.
+     * A UTF-8 target is copied as-is.
+     */
+    template <typename Char_T, typename Stream_T, typename UTF8Char_T>
+    static void FromUTF8(const UTF8Char_T *str, SizeT length, Stream_T &stream) {
+        if constexpr (sizeof(Char_T) == 1U) {
+            stream.Write(reinterpret_cast<const Char_T *>(str), length);
+        } else {
+            constexpr SizeT buffer_size = 64U;
+            Char_T          buffer[buffer_size];
+            SizeT           index{0};
+
+            stream.Expect(length);
+
+            while (index < length) {
+                SizeT count{0};
+
+                while ((index < length) && (count < buffer_size) && (SizeT32(SizeT8(str[index])) < 0x80U)) {
+                    buffer[count] = Char_T(str[index]);
+                    ++count;
+                    ++index;
+                }
+
+                if (count != 0) {
+                    stream.Write(buffer, count);
+                    continue;
+                }
+
+                const SizeT32 lead = SizeT8(str[index]);
+                SizeT32       unicode;
+                SizeT         extra;
+                SizeT32       min;
+
+                ++index;
+
+                if ((lead & 0xE0U) == 0xC0U) {
+                    unicode = (lead & 0x1FU);
+                    extra   = 1U;
+                    min     = 0x80U;
+                } else if ((lead & 0xF0U) == 0xE0U) {
+                    unicode = (lead & 0x0FU);
+                    extra   = 2U;
+                    min     = 0x800U;
+                } else if ((lead & 0xF8U) == 0xF0U) {
+                    unicode = (lead & 0x07U);
+                    extra   = 3U;
+                    min     = 0x10000U;
+                } else {
+                    UnicodeToUTF<Char_T, Stream_T, sizeof(Char_T)>::ToUTF(0xFFFDU, stream);
+                    continue;
+                }
+
+                while ((extra != 0) && (index < length) && ((SizeT8(str[index]) & 0xC0U) == 0x80U)) {
+                    unicode = ((unicode << 6U) | (SizeT8(str[index]) & 0x3FU));
+                    ++index;
+                    --extra;
+                }
+
+                if ((extra != 0) || (unicode < min) || (unicode > 0x10FFFFU) ||
+                    ((unicode >= 0xD800U) && (unicode <= 0xDFFFU))) {
+                    unicode = 0xFFFDU;
+                }
+
+                UnicodeToUTF<Char_T, Stream_T, sizeof(Char_T)>::ToUTF(unicode, stream);
+            }
+        }
+    }
 };
 
 } // namespace Qentem
@@ -34,6 +34,9 @@ enum struct ValueType : SizeT8 {
     False,
     Null
 };
+
+template <typename Char_T>
+struct CompactTree;
 ///////////////////////////////////////////////
 template <typename Char_T>
 struct Value {
@@ -46,6 +49,8 @@ struct Value {
 
     using VItem = typename ObjectT::HItem;
 
+    struct SharedBlock;
+
     Value() noexcept : array_{} {
     }
 
@@ -66,6 +71,14 @@ struct Value {
                 break;
             }
 
+            case ValueType::ValuePtr: {
+                if (is_shared_) {
+                    releaseShared();
+                }
+
+                break;
+            }
+
             default: {
             }
         }
@@ -94,7 +107,9 @@ struct Value {
         }
 
         setType(val.Type());
+        is_shared_ = val.is_shared_;
         val.setTypeToUndefined();
+        val.is_shared_ = false;
     }
 
     Value(const Value &val) : array_{} {
@@ -202,12 +217,15 @@ struct Value {
 
     Value &operator=(Value &&val) noexcept {
         if (this != &val) {
-            const ValueType type = val.Type();
+            const ValueType type   = val.Type();
+            const bool      shared = val.is_shared_;
 
             val.setTypeToUndefined();
+            val.is_shared_ = false;
 
             reset();
             setType(type);
+            is_shared_ = shared;
 
             switch (type) {
                 case ValueType::Object: {
@@ -252,6 +270,40 @@ struct Value {
         }
     }
 
+    /**
+     * @brief Moves an object, array or string into a reference-counted block that copies share.
+     *
+     * Copying a shared value then only increments the count, so handing a large tree to
+     * another component costs O(1). Reading goes through it as it does through a pointer
+     * value. Anything that can change a copy, including the non-const accessors, first
+     * gives that copy its own content (copy-on-write); the last reference takes the
+     * content over without copying. Other types are left as they are.
+     *
+     * The count is atomic, so copies may be read, changed and dropped on other threads. The
+     * block and its content come from the sharing thread's Reserver, which is thread-local,
+     * so that thread must hold a reference of its own until every other thread is done with
+     * theirs (e.g. after joining them), and drop it last. A copy on another thread that turns
+     * out to be the last one would release the block into the wrong Reserver.
+     */
+    void Share() {
+        const ValueType type = Type();
+
+        if ((type == ValueType::Object) || (type == ValueType::Array) || (type == ValueType::String)) {
+            SharedBlock *block = Reserver::Reserve<SharedBlock>(1);
+            MemoryUtils::Construct(&(block->Data), QUtility::Move(*this));
+            block->References = SizeT32{1};
+            block->Hash       = SizeT64{0};
+
+            setTypeToPtrValue();
+            value_     = &(block->Data);
+            is_shared_ = true;
+        }
+    }
+
+    QENTEM_INLINE bool IsShared() const noexcept {
+        return (is_shared_ && isPtrValue());
+    }
+
     Value &operator=(ObjectT &&obj) noexcept {
         reset();
         setTypeToObject();
@@ -410,6 +462,8 @@ struct Value {
     }
 
     void operator+=(Value &&val) {
+        unshare();
+
         if (isObject() && val.isObject()) {
             object_ += QUtility::Move(val.object_);
             val.setTypeToUndefined();
@@ -424,6 +478,8 @@ struct Value {
     }
 
     void operator+=(const Value &val) {
+        unshare();
+
         if (isObject() && val.isObject()) {
             object_ += val.object_;
         } else {
@@ -438,6 +494,8 @@ struct Value {
 
     // Only to value of type array
     void AddPointerToValue(const Value *val_ptr) {
+        unshare();
+
         if (!isArray()) {
             reset();
             setTypeToArray();
@@ -450,6 +508,8 @@ struct Value {
     }
 
     void operator+=(ObjectT &&obj) {
+        unshare();
+
         if (isObject()) {
             object_ += QUtility::Move(obj);
         } else {
@@ -467,6 +527,8 @@ struct Value {
     }
 
     void operator+=(ArrayT &&arr) {
+        unshare();
+
         if (!isArray()) {
             reset();
             setTypeToArray();
@@ -484,6 +546,8 @@ struct Value {
     }
 
     void operator+=(StringT &&str) {
+        unshare();
+
         if (!isArray()) {
             reset();
             setTypeToArray();
@@ -506,6 +570,8 @@ struct Value {
 
     template <typename Number_T>
     void operator+=(Number_T num) {
+        unshare();
+
         if (!isArray()) {
             reset();
             setTypeToArray();
@@ -515,6 +581,8 @@ struct Value {
     }
 
     void operator+=(NullType) {
+        unshare();
+
         if (!isArray()) {
             reset();
             setTypeToArray();
@@ -524,6 +592,8 @@ struct Value {
     }
 
     void operator+=(bool is_true) {
+        unshare();
+
         if (!isArray()) {
             reset();
             setTypeToArray();
@@ -539,6 +609,8 @@ struct Value {
     }
 
     Value &operator[](const Char_T *str) {
+        unshare();
+
         if (!isObject()) {
             reset();
             setTypeToObject();
@@ -548,6 +620,8 @@ struct Value {
     }
 
     Value &operator[](const StringViewT &key) {
+        unshare();
+
         if (!isObject()) {
             reset();
             setTypeToObject();
@@ -557,6 +631,8 @@ struct Value {
     }
 
     Value &operator[](StringT &&key) {
+        unshare();
+
         if (!isObject()) {
             reset();
             setTypeToObject();
@@ -566,6 +642,8 @@ struct Value {
     }
 
     Value &operator[](const StringT &key) {
+        unshare();
+
         if (!isObject()) {
             reset();
             setTypeToObject();
@@ -575,6 +653,8 @@ struct Value {
     }
 
     Value &operator[](SizeT index) {
+        unshare();
+
         const ValueType type = Type();
 
         if (type == ValueType::Array) {
@@ -610,6 +690,8 @@ struct Value {
 
     // Will insert the str if it does not exist.
     Value &Get(const Char_T *str, SizeT length) {
+        unshare();
+
         if (!isObject()) {
             reset();
             setTypeToObject();
@@ -619,6 +701,8 @@ struct Value {
     }
 
     Value &Get(const StringViewT &key) {
+        unshare();
+
         if (!isObject()) {
             reset();
             setTypeToObject();
@@ -628,6 +712,8 @@ struct Value {
     }
 
     void Insert(const StringViewT &key, Value &&val) {
+        unshare();
+
         if (!isObject()) {
             reset();
             setTypeToObject();
@@ -871,7 +957,115 @@ struct Value {
         return (type > val.Type());
     }
 
+    /**
+     * @brief Deep comparison: same types and same content all the way down.
+     *
+     * Objects compare member by member in any order; arrays item by item. Removed items
+     * are skipped on both sides. Unlike operator==, which looks at this node only, numbers
+     * of different types are not equal. Shared values (see Share()) holding the same block
+     * are equal at once, and ones whose hashes differ are not; other values are compared
+     * all the way down, as nothing caches their hash (see Hash()).
+     */
+    bool Equals(const Value &val) const noexcept {
+        return equals(*this, val, false);
+    }
+
+    /**
+     * @brief Deep comparison as JSON sees it: like Equals(), except that numbers compare by
+     * value whatever their type, so 1, 1.0 and an IntLong 1 are all equal. This is the
+     * equality of JSON Patch (RFC 6902) "test". No conversion rounds: 2^53 + 1 does not
+     * equal the double 2^53.
+     */
+    bool EqualsNumerically(const Value &val) const noexcept {
+        return equals(*this, val, true);
+    }
+
+    /**
+     * @brief Uncached 64-bit structural hash: values that Equals() calls equal hash the same.
+     *
+     * Computed bottom-up. Members of an object are combined regardless of order, items of
+     * an array in order, and removed items are skipped. Usable as a cache key; equal hashes
+     * are not proof of equality, but different ones are proof of a change.
+     *
+     * Nothing is stored in ordinary trees, so every call walks them: O(n) in the number of
+     * values; keep the result if it is needed again. A per-node cache, cleared along the path
+     * on each change, is not provided: a value has no room for one and no link to its parent,
+     * and a child pointer taken earlier could change the child behind the parent's back.
+     *
+     * Shared values (see Share()) are where "unchanged?" is O(1). Their content cannot change,
+     * so each block keeps its hash after the first time, and a tree built from shared subtrees
+     * rehashes only the parts that are not. Any change to a copy gives it its own content, so
+     * a copy that is still shared is unchanged, and Equals() on two values holding the same
+     * block returns at once. Pointer values are hashed through; a shared tree holding pointers
+     * to values outside it keeps the hash it first saw.
+     */
+    SizeT64 Hash() const noexcept {
+        switch (Type()) {
+            case ValueType::Object: {
+                const VItem *item = object_.First();
+                const VItem *end  = (item + object_.Size());
+                SizeT64      members{0};
+                SizeT64      count{0};
+
+                while (item != end) {
+                    if (!(item->Value.isUndefined())) {
+                        members += hashCombine(hashString(item->Key.First(), item->Key.Length()), item->Value.Hash());
+                        ++count;
+                    }
+
+                    ++item;
+                }
+
+                return hashCombine(hashCombine(static_cast<SizeT64>(ValueType::Object), count), members);
+            }
+
+            case ValueType::Array: {
+                const Value *item = array_.First();
+                const Value *end  = array_.End();
+                SizeT64      hash = static_cast<SizeT64>(ValueType::Array);
+                SizeT64      count{0};
+
+                while (item != end) {
+                    if (!(item->isUndefined())) {
+                        hash = hashCombine(hash, item->Hash());
+                        ++count;
+                    }
+
+                    ++item;
+                }
+
+                return hashCombine(hash, count);
+            }
+
+            case ValueType::String: {
+                return hashCombine(static_cast<SizeT64>(ValueType::String),
+                                   hashString(string_.First(), string_.Length()));
+            }
+
+            case ValueType::UIntLong:
+            case ValueType::IntLong: {
+                return hashCombine(static_cast<SizeT64>(Type()), number_.Natural);
+            }
+
+            case ValueType::Double: {
+                // 0.0 and -0.0 are equal but differ in bits.
+                const SizeT64 bits = ((number_.Real == 0) ? SizeT64{0} : number_.Natural);
+                return hashCombine(static_cast<SizeT64>(ValueType::Double), bits);
+            }
+
+            case ValueType::ValuePtr: {
+                return (is_shared_ ? sharedHash() : value_->Hash());
+            }
+
+            default: {
+                return hashMix(static_cast<SizeT64>(Type()));
+            }
+        }
+    }
+
     void Merge(Value &&val) {
+        unshare();
+
         if (isUndefined()) {
             setTypeToArray();
         }
@@ -895,6 +1089,8 @@ struct Value {
     }
 
     void Merge(const Value &val) {
+        unshare();
+
         if (isUndefined()) {
             setTypeToArray();
         }
@@ -1129,6 +1325,8 @@ struct Value {
     }
 
     Value *GetValueAt(SizeT index) noexcept {
+        unshare();
+
         switch (Type()) {
             case ValueType::Object: {
                 Value *val = object_.GetValueAt(index);
@@ -1208,6 +1406,8 @@ struct Value {
      * @return Pointer to the value, or nullptr if not found.
      */
     Value *GetValue(const Char_T *str, SizeT length, SizeT hash) noexcept {
+        unshare();
+
         switch (Type()) {
             case ValueType::Object: {
                 Value *val = object_.GetValue(str, length, hash);
@@ -1305,6 +1505,8 @@ struct Value {
      * @return Pointer to the value, or nullptr if not found.
      */
     Value *GetValue(const Char_T *str, SizeT length) noexcept {
+        unshare();
+
         switch (Type()) {
             case ValueType::Object: {
                 Value *val = object_.GetValue(str, length);
@@ -1443,6 +1645,8 @@ struct Value {
     }
 
     Value *Storage() {
+        unshare();
+
         switch (Type()) {
             case ValueType::Object: {
                 VItem *item = object_.Storage();
@@ -1510,6 +1714,8 @@ struct Value {
     }
 
     Value *Last() {
+        unshare();
+
         switch (Type()) {
             case ValueType::Object: {
                 VItem *item = object_.Last();
@@ -1607,6 +1813,8 @@ struct Value {
     }
 
     ObjectT *GetObject() noexcept {
+        unshare();
+
         if (isObject()) {
             return &(object_);
         }
@@ -1629,6 +1837,8 @@ struct Value {
     }
 
     ArrayT *GetArray() noexcept {
+        unshare();
+
         if (isArray()) {
             return &(array_);
         }
@@ -1651,6 +1861,8 @@ struct Value {
     }
 
     StringT *GetString() noexcept {
+        unshare();
+
         if (isString()) {
             return &(string_);
         }
@@ -1672,6 +1884,12 @@ struct Value {
         return StringViewT{};
     }
 
+    /**
+     * @brief The characters of a string value, or nullptr for any other type.
+     *
+     * Use Length() for where they end: a string that borrows from its input (see
+     * JSON::ParseBorrowed()) is not null-terminated.
+     */
     const Char_T *StringStorage() const noexcept {
         const ValueType type = Type();
 
@@ -2035,6 +2253,8 @@ struct Value {
     }
 
     QENTEM_INLINE void Remove(const Char_T *str, SizeT length) noexcept {
+        unshare();
+
         if (isObject()) {
             object_.Remove(str, length);
         }
@@ -2049,6 +2269,8 @@ struct Value {
     }
 
     void RemoveAt(SizeT index) noexcept {
+        unshare();
+
         if (isObject()) {
             object_.RemoveAt(index);
         } else if (isArray() && (index < array_.Size())) {
@@ -2152,6 +2374,11 @@ struct Value {
         return type_;
     }
 
+    // The type of the value, or of the one it points to for a ValuePtr, as the Is*() checks see it.
+    QENTEM_INLINE ValueType TargetType() const noexcept {
+        return ((type_ == ValueType::ValuePtr) ? value_->type_ : type_);
+    }
+
     bool GroupBy(Value &groupedValue, const Char_T *key_str, const SizeT length) const {
         const ValueType type = Type();
 
@@ -2233,47 +2460,164 @@ struct Value {
         return GroupBy(groupedValue, str, StringUtils::Count(str));
     }
 
-    // Set ascend to (false) for descend (ascend: 1,2,3; descend: 3,2,1 )
+    /**
+     * @brief Sorts an array by its items, or an object by its keys; equal items keep their order.
+     *
+     * Set ascend to (false) for descend (ascend: 1,2,3; descend: 3,2,1 ). An array whose items
+     * are all numbers of one type is radix sorted on the numbers themselves, and one of only
+     * strings is sorted on their text; other arrays compare their items as operator< does.
+     */
     void Sort(bool ascend = true) noexcept {
+        unshare();
+
         const ValueType type = Type();
 
         if (type == ValueType::Object) {
             object_.Sort(ascend);
         } else if (type == ValueType::Array) {
-            array_.Sort(ascend);
+            sortItems(array_.Storage(), array_.Size(), ascend);
         }
     }
 
-    template <typename Stream_T>
-    Stream_T &Stringify(Stream_T &stream, SizeT32 precision = QentemConfig::DoublePrecision) const {
-        const ValueType type = Type();
+    /**
+     * @brief Sorts the items [start, end) of an array, for sorting a large one in parts.
+     *
+     * Sort() does the whole array on one thread. To use more, give each thread a range of its
+     * own to sort with SortRange(), then, once all are done, join them with MergeSorted():
+     *
+     *     // On thread i of n, with part = (size / n):
+     *     value.SortRange((part * i), (((i + 1) == n) ? size : (part * (i + 1))));
+     *     // Then, on the thread that owns the value, with ends[i] the end of range i:
+     *     value.MergeSorted(ends, n);
+     *
+     * Items only move within the array, and what a range needs to be sorted is released before
+     * it returns, so ranges may be sorted on any thread, as long as nothing else uses the value
+     * meanwhile. A shared value (see Share()) is left as it is: making it an array of its own
+     * would reserve memory on the wrong thread, so that must be done before (e.g. by GetArray()).
+     */
+    void SortRange(SizeT start, SizeT end, bool ascend = true) noexcept {
+        if (Type() == ValueType::Array) {
+            if (end > array_.Size()) {
+                end = array_.Size();
+            }
 
-        switch (type) {
-            case ValueType::Object: {
-                stringifyObject(object_, stream, precision);
-                break;
+            if (start < end) {
+                sortItems((array_.Storage() + start), (end - start), ascend);
             }
+        }
+    }
 
-            case ValueType::Array: {
-                stringifyArray(array_, stream, precision);
-                break;
+    /**
+     * @brief Joins the sorted ranges of an array into one sorted array; see SortRange().
+     *
+     * @param ends  The end of each range, in order; the last one is the size of the array.
+     * @param parts The number of ranges.
+     * @return false if the value is not an array, or the ranges do not cover it.
+     */
+    bool MergeSorted(const SizeT *ends, SizeT parts, bool ascend = true) {
+        if ((Type() != ValueType::Array) || (parts == 0) || (ends[parts - SizeT{1}] != array_.Size())) {
+            return false;
+        }
+
+        for (SizeT index = 1; index < parts; index++) {
+            if (ends[index] < ends[index - SizeT{1}]) {
+                return false;
             }
+        }
 
-            case ValueType::ValuePtr: {
-                value_->Stringify(stream, precision);
-                break;
+        const SizeT size = array_.Size();
+
+        if ((parts > SizeT{1}) && (size > SizeT{1})) {
+            using EntryT = QUtility::SortEntry<QUtility::SortRef<Value>, SizeT>;
+
+            Array<EntryT> entries{size, true};
+            Array<EntryT> buffer{size, true};
+            Array<SizeT>  bounds{parts};
+            Value        *items = array_.Storage();
+            EntryT       *from  = entries.Storage();
+            EntryT       *to    = buffer.Storage();
+
+            for (SizeT index = 0; index < size; index++) {
+                from[index].Key.Data = (items + index);
+                from[index].Index    = index;
             }
 
-            default: {
+            for (SizeT index = 0; index < parts; index++) {
+                bounds += ends[index];
             }
+
+            // Each pass merges neighboring ranges in pairs, halving their number.
+            while (parts > SizeT{1}) {
+                SizeT *bound = bounds.Storage();
+                SizeT  start = 0;
+                SizeT  count = 0;
+
+                for (SizeT index = 0; index < parts; index += SizeT{2}) {
+                    const SizeT middle = bound[index];
+                    const SizeT end    = (((index + SizeT{1}) < parts) ? bound[index + SizeT{1}] : middle);
+
+                    if (ascend) {
+                        QUtility::MergeRuns<true>(from, to, start, middle, end);
+                    } else {
+                        QUtility::MergeRuns<false>(from, to, start, middle, end);
+                    }
+
+                    bound[count] = end;
+                    start        = end;
+                    ++count;
+                }
+
+                parts = count;
+
+                EntryT *swap = from;
+                from         = to;
+                to           = swap;
+            }
+
+            reorder(items, from, size);
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Writes the value as JSON to stream.
+     *
+     * The output length is measured first and reserved in one step, so the stream does not
+     * grow while writing. With indent above zero, the output is broken into lines, each
+     * level indented by that many spaces; zero gives compact output.
+     */
+    template <typename Stream_T>
+    Stream_T &Stringify(Stream_T &stream, SizeT32 precision = QentemConfig::DoublePrecision,
+                        SizeT32 indent = 0) const {
+        const Value *value = this;
+
+        while (value->Type() == ValueType::ValuePtr) {
+            value = value->value_;
+        }
+
+        const ValueType type = value->Type();
+
+        if ((type == ValueType::Object) || (type == ValueType::Array)) {
+            stream.Expect(stringifiedLength(*value, precision, indent, 0));
+            stringifyValue(*value, stream, precision, indent, 0);
         }
 
         return stream;
     }
 
-    QENTEM_INLINE StringT Stringify(SizeT32 precision = QentemConfig::DoublePrecision) const {
+    QENTEM_INLINE StringT Stringify(SizeT32 precision = QentemConfig::DoublePrecision, SizeT32 indent = 0) const {
         StringStream<Char_T> stream;
-        return Stringify(stream, precision).GetString();
+        return Stringify(stream, precision, indent).GetString();
+    }
+
+    /**
+     * @brief Makes an immutable, compact copy for data that is read far more than written.
+     *
+     * Objects with many members get a hash index. Needs Qentem/CompactValue.hpp.
+     */
+    QENTEM_INLINE CompactTree<Char_T> Freeze() const {
+        return CompactTree<Char_T>{*this};
     }
 
     // ===== STL-style Iterators =====
@@ -2295,71 +2639,326 @@ struct Value {
     }
 
   private:
+    // Sorts count items on keys taken out of them once, then moves each item to its place.
+    // Arrays of mixed items compare whole Values, through pointers to them.
+    static void sortItems(Value *items, SizeT count, bool ascend) {
+        if (count > SizeT{1}) {
+            const ValueType type  = items[0].Type();
+            SizeT           index = 1;
+
+            while ((index < count) && (items[index].Type() == type)) {
+                ++index;
+            }
+
+            if (index != count) {
+                sortByKey<QUtility::SortRef<Value>>(items, count, ascend);
+                return;
+            }
+
+            switch (type) {
+                case ValueType::UIntLong: {
+                    sortByKey<SizeT64>(items, count, ascend, QNumberType::Natural);
+                    break;
+                }
+
+                case ValueType::IntLong: {
+                    sortByKey<SizeT64>(items, count, ascend, QNumberType::Integer);
+                    break;
+                }
+
+                case ValueType::Double: {
+                    sortByKey<SizeT64>(items, count, ascend, QNumberType::Real);
+                    break;
+                }
+
+                case ValueType::String: {
+                    sortByKey<StringViewT>(items, count, ascend);
+                    break;
+                }
+
+                default: {
+                    sortByKey<QUtility::SortRef<Value>>(items, count, ascend);
+                }
+            }
+        }
+    }
+
+    // type is the number type of every item when Key_T is SizeT64.
+    template <typename Key_T>
+    static void sortByKey(Value *items, SizeT count, bool ascend, QNumberType type = QNumberType::NotANumber) {
+        using EntryT = QUtility::SortEntry<Key_T, SizeT>;
+
+        Array<EntryT> entries{count, true};
+        Array<EntryT> buffer{count, true};
+        EntryT       *entry = entries.Storage();
+
+        for (SizeT index = 0; index < count; index++) {
+            if constexpr (QTraits::IsSame<Key_T, SizeT64>::Value) {
+                entry[index].Key = items[index].number_.SortKey(type);
+            } else if constexpr (QTraits::IsSame<Key_T, StringViewT>::Value) {
+                entry[index].Key = StringViewT{items[index].string_.First(), items[index].string_.Length()};
+            } else {
+                entry[index].Key.Data = (items + index);
+            }
+
+            entry[index].Index = index;
+        }
+
+        reorder(items, QUtility::SortEntries(entry, buffer.Storage(), count, ascend), count);
+    }
+
+    // Equals() and EqualsNumerically(); by_value compares numbers of different types by value.
+    static bool equals(const Value &first, const Value &second, bool by_value) noexcept {
+        const Value *left  = &first;
+        const Value *right = &second;
+
+        if (left->IsShared() && right->IsShared()) {
+            if (left->value_ == right->value_) {
+                return true;
+            }
+
+            // Hash() keeps number types apart, so it only rules out a match of exact types.
+            if (!by_value && (left->sharedHash() != right->sharedHash())) {
+                return false;
+            }
+        }
+
+        while (left->isPtrValue()) {
+            left = left->value_;
+        }
+
+        while (right->isPtrValue()) {
+            right = right->value_;
+        }
+
+        if (left == right) {
+            return true;
+        }
+
+        if (left->Type() != right->Type()) {
+            return (by_value && left->IsNumber() && right->IsNumber() && sameNumber(*left, *right));
+        }
+
+        switch (left->Type()) {
+            case ValueType::Object: {
+                const VItem *item = left->object_.First();
+                const VItem *end  = (item + left->object_.Size());
+                SizeT        count{0};
+
+                while (item != end) {
+                    if (!(item->Value.isUndefined())) {
+                        const Value *other = right->object_.GetValue(item->Key.First(), item->Key.Length());
+
+                        if ((other == nullptr) || !(equals(item->Value, *other, by_value))) {
+                            return false;
+                        }
+
+                        ++count;
+                    }
+
+                    ++item;
+                }
+
+                item = right->object_.First();
+                end  = (item + right->object_.Size());
+
+                while (item != end) {
+                    count -= SizeT{!(item->Value.isUndefined())};
+                    ++item;
+                }
+
+                return (count == 0);
+            }
+
+            case ValueType::Array: {
+                const Value *left_item  = left->array_.First();
+                const Value *left_end   = left->array_.End();
+                const Value *right_item = right->array_.First();
+                const Value *right_end  = right->array_.End();
+
+                while (true) {
+                    while ((left_item != left_end) && left_item->isUndefined()) {
+                        ++left_item;
+                    }
+
+                    while ((right_item != right_end) && right_item->isUndefined()) {
+                        ++right_item;
+                    }
+
+                    if ((left_item == left_end) || (right_item == right_end)) {
+                        return ((left_item == left_end) && (right_item == right_end));
+                    }
+
+                    if (!(equals(*left_item, *right_item, by_value))) {
+                        return false;
+                    }
+
+                    ++left_item;
+                    ++right_item;
+                }
+            }
+
+            case ValueType::String: {
+                return (left->string_ == right->string_);
+            }
+
+            case ValueType::UIntLong: {
+                return (left->number_.Natural == right->number_.Natural);
+            }
+
+            case ValueType::IntLong: {
+                return (left->number_.Integer == right->number_.Integer);
+            }
+
+            case ValueType::Double: {
+                return (left->number_.Real == right->number_.Real);
+            }
+
+            default: {
+                return true;
+            }
+        }
+    }
+
+    // Whether two numbers of different types hold the same value, without rounding either one.
+    static bool sameNumber(const Value &left, const Value &right) noexcept {
+        if (left.Type() > right.Type()) {
+            return sameNumber(right, left);
+        }
+
+        // UIntLong, IntLong and Double are declared in that order.
+        if (right.Type() == ValueType::IntLong) {
+            return ((right.number_.Integer >= 0) && (SizeT64(right.number_.Integer) == left.number_.Natural));
+        }
+
+        const double real = right.number_.Real;
+
+        if (left.Type() == ValueType::UIntLong) {
+            // 2^64 and above do not convert; neither does NaN, which fails both tests.
+            if (!((real >= 0.0) && (real < 18446744073709551616.0))) {
+                return false;
+            }
+
+            const SizeT64 natural = SizeT64(real);
+            return ((natural == left.number_.Natural) && (double(natural) == real));
+        }
+
+        if (!((real >= -9223372036854775808.0) && (real < 9223372036854775808.0))) {
+            return false;
+        }
+
+        const SizeT64I integer = SizeT64I(real);
+        return ((integer == left.number_.Integer) && (double(integer) == real));
+    }
+
+    // Moves items into the order of sorted entries, through memory that is released here.
+    template <typename Entry_T>
+    static void reorder(Value *items, const Entry_T *sorted, SizeT count) {
+        Value *scratch = Reserver::Reserve<Value>(count);
+
+        MemoryUtils::Gather(scratch, items, sorted, count);
+        MemoryUtils::CopyTo(items, scratch, count);
+        Reserver::Release(scratch, count);
+    }
+
+    // Line break and indentation before an item or a closing bracket; nothing when compact.
     template <typename Stream_T>
-    static void stringifyObject(const ObjectT &obj, Stream_T &stream, SizeT32 precision) {
-        stream.Write(NotationConstants::SCurlyChar);
+    static void stringifyBreak(Stream_T &stream, SizeT32 indent, SizeT32 depth) {
+        if (indent != 0) {
+            SizeT32 spaces = (indent * depth);
+            Char_T *str    = stream.Buffer(SizeT(spaces + SizeT32{1}));
 
+            *str = NotationConstants::LineControlChar;
+
+            while (spaces != 0) {
+                ++str;
+                *str = NotationConstants::SpaceChar;
+                --spaces;
+            }
+        }
+    }
+
+    template <typename Stream_T>
+    static void stringifyObject(const ObjectT &obj, Stream_T &stream, SizeT32 precision, SizeT32 indent,
+                                SizeT32 depth) {
         const VItem *h_item = obj.First();
         const VItem *end    = (h_item + obj.Size());
+        bool         first  = true;
+
+        stream.Write(NotationConstants::SCurlyChar);
 
         while (h_item != end) {
             if ((h_item != nullptr) && !(h_item->Value.isUndefined())) {
+                if (!first) {
+                    stream.Write(NotationConstants::CommaChar);
+                }
+
+                first = false;
+                stringifyBreak(stream, indent, (depth + 1U));
+
                 stream.Write(NotationConstants::QuoteChar);
                 JSONUtils::Escape(h_item->Key.First(), h_item->Key.Length(), stream);
                 stream.Write(NotationConstants::QuoteChar);
                 stream.Write(NotationConstants::ColonChar);
 
-                stringifyValue(h_item->Value, stream, precision);
-                stream.Write(NotationConstants::CommaChar);
+                if (indent != 0) {
+                    stream.Write(NotationConstants::SpaceChar);
+                }
+
+                stringifyValue(h_item->Value, stream, precision, indent, (depth + 1U));
             }
 
             ++h_item;
         }
 
-        Char_T *last = stream.Last();
-
-        if ((last != nullptr) && (*last == NotationConstants::CommaChar)) {
-            *last = NotationConstants::ECurlyChar;
-        } else {
-            stream.Write(NotationConstants::ECurlyChar);
+        if (!first) {
+            stringifyBreak(stream, indent, depth);
         }
+
+        stream.Write(NotationConstants::ECurlyChar);
     }
 
     template <typename Stream_T>
-    static void stringifyArray(const ArrayT &arr, Stream_T &stream, SizeT32 precision) {
-        stream.Write(NotationConstants::SSquareChar);
+    static void stringifyArray(const ArrayT &arr, Stream_T &stream, SizeT32 precision, SizeT32 indent,
+                               SizeT32 depth) {
+        const Value *item  = arr.First();
+        const Value *end   = arr.End();
+        bool         first = true;
 
-        const Value *item = arr.First();
-        const Value *end  = arr.End();
+        stream.Write(NotationConstants::SSquareChar);
 
         while (item != end) {
             if (!(item->isUndefined())) {
-                stringifyValue(*item, stream, precision);
-                stream.Write(NotationConstants::CommaChar);
+                if (!first) {
+                    stream.Write(NotationConstants::CommaChar);
+                }
+
+                first = false;
+                stringifyBreak(stream, indent, (depth + 1U));
+                stringifyValue(*item, stream, precision, indent, (depth + 1U));
             }
 
             ++item;
         }
 
-        Char_T *last = stream.Last();
-
-        if (*last == NotationConstants::CommaChar) {
-            *last = NotationConstants::ESquareChar;
-        } else {
-            stream.Write(NotationConstants::ESquareChar);
+        if (!first) {
+            stringifyBreak(stream, indent, depth);
         }
+
+        stream.Write(NotationConstants::ESquareChar);
     }
 
     template <typename Stream_T>
-    static void stringifyValue(const Value &val, Stream_T &stream, SizeT32 precision) {
+    static void stringifyValue(const Value &val, Stream_T &stream, SizeT32 precision, SizeT32 indent,
+                               SizeT32 depth) {
         switch (val.Type()) {
             case ValueType::Object: {
-                stringifyObject(val.object_, stream, precision);
+                stringifyObject(val.object_, stream, precision, indent, depth);
                 break;
             }
 
             case ValueType::Array: {
-                stringifyArray(val.array_, stream, precision);
+                stringifyArray(val.array_, stream, precision, indent, depth);
                 break;
             }
 
@@ -2401,7 +3000,7 @@ struct Value {
             }
 
             case ValueType::ValuePtr: {
-                stringifyValue(*(val.value_), stream, precision);
+                stringifyValue(*(val.value_), stream, precision, indent, depth);
                 break;
             }
 
@@ -2410,6 +3009,119 @@ struct Value {
         }
     }
 
+    /*
+     * The length stringifyValue() will write, following the same steps. Doubles are counted
+     * at their longest form for the given precision (sign, dot and a three-digit exponent),
+     * so the result may run a few characters over, never under.
+     */
+    static SizeT stringifiedLength(const Value &val, SizeT32 precision, SizeT32 indent, SizeT32 depth) noexcept {
+        switch (val.Type()) {
+            case ValueType::Object: {
+                const VItem *h_item = val.object_.First();
+                const VItem *end    = (h_item + val.object_.Size());
+                SizeT        count{0};
+                SizeT        length{2}; // {}
+
+                while (h_item != end) {
+                    if ((h_item != nullptr) && !(h_item->Value.isUndefined())) {
+                        length += (JSONUtils::EscapedLength(h_item->Key.First(), h_item->Key.Length()) + SizeT{3});
+                        length += stringifiedLength(h_item->Value, precision, indent, (depth + 1U));
+                        ++count;
+                    }
+
+                    ++h_item;
+                }
+
+                return (length + containerExtraLength(count, indent, depth) + ((indent != 0) ? count : 0));
+            }
+
+            case ValueType::Array: {
+                const Value *item = val.array_.First();
+                const Value *end  = val.array_.End();
+                SizeT        count{0};
+                SizeT        length{2}; // []
+
+                while (item != end) {
+                    if (!(item->isUndefined())) {
+                        length += stringifiedLength(*item, precision, indent, (depth + 1U));
+                        ++count;
+                    }
+
+                    ++item;
+                }
+
+                return (length + containerExtraLength(count, indent, depth));
+            }
+
+            case ValueType::String: {
+                return (JSONUtils::EscapedLength(val.string_.First(), val.string_.Length()) + SizeT{2});
+            }
+
+            case ValueType::UIntLong: {
+                return digitCount(val.number_.Natural);
+            }
+
+            case ValueType::IntLong: {
+                if (val.number_.Integer < 0) {
+                    return (digitCount(SizeT64(0) - SizeT64(val.number_.Integer)) + SizeT{1});
+                }
+
+                return digitCount(SizeT64(val.number_.Integer));
+            }
+
+            case ValueType::Double: {
+                return SizeT(precision + SizeT32{7});
+            }
+
+            case ValueType::False: {
+                return NotationConstants::FalseStringLength;
+            }
+
+            case ValueType::True: {
+                return NotationConstants::TrueStringLength;
+            }
+
+            case ValueType::Null: {
+                return NotationConstants::NullStringLength;
+            }
+
+            case ValueType::ValuePtr: {
+                return stringifiedLength(*(val.value_), precision, indent, depth);
+            }
+
+            default: {
+                return 0;
+            }
+        }
+    }
+
+    // Commas between count items, plus the line breaks before each item and the closing bracket.
+    QENTEM_INLINE static SizeT containerExtraLength(SizeT count, SizeT32 indent, SizeT32 depth) noexcept {
+        if (count == 0) {
+            return 0;
+        }
+
+        SizeT length = (count - SizeT{1});
+
+        if (indent != 0) {
+            length += (count * SizeT(SizeT32{1} + (indent * (depth + 1U))));
+            length += SizeT(SizeT32{1} + (indent * depth));
+        }
+
+        return length;
+    }
+
+    QENTEM_INLINE static SizeT digitCount(SizeT64 number) noexcept {
+        SizeT count{1};
+
+        while (number >= SizeT64{10}) {
+            number /= SizeT64{10};
+            ++count;
+        }
+
+        return count;
+    }
+
     QENTEM_INLINE bool isUndefined() const noexcept {
         return (Type() == ValueType::Undefined);
     }
@@ -2500,6 +3212,7 @@ struct Value {
 
     QENTEM_INLINE void setTypeToPtrValue() noexcept {
         setType(ValueType::ValuePtr);
+        is_shared_ = false;
     }
 
     void reset() noexcept {
@@ -2519,6 +3232,15 @@ struct Value {
                 break;
             }
 
+            case ValueType::ValuePtr: {
+                if (is_shared_) {
+                    releaseShared();
+                }
+
+                number_.Natural = SizeT64{0};
+                break;
+            }
+
             default: {
                 number_.Natural = SizeT64{0};
             }
@@ -2542,6 +3264,16 @@ struct Value {
                 break;
             }
 
+            case ValueType::ValuePtr: {
+                if (val.is_shared_) {
+                    Platform::AtomicIncrement(val.sharedBlock()->References);
+                    is_shared_ = true;
+                }
+
+                value_ = val.value_;
+                break;
+            }
+
             default: {
                 number_ = val.number_;
             }
@@ -2550,6 +3282,92 @@ struct Value {
         setType(val.Type());
     }
 
+    QENTEM_INLINE SharedBlock *sharedBlock() const noexcept {
+        return reinterpret_cast<SharedBlock *>(const_cast<Value *>(value_));
+    }
+
+    // Zero marks a block not yet hashed; a hash that comes out as zero is just not kept.
+    SizeT64 sharedHash() const noexcept {
+        SharedBlock *block = sharedBlock();
+        SizeT64      hash  = Platform::AtomicLoad(block->Hash);
+
+        if (hash == 0) {
+            hash = block->Data.Hash();
+            Platform::AtomicStore(block->Hash, hash);
+        }
+
+        return hash;
+    }
+
+    // The finalizer of MurmurHash3.
+    QENTEM_INLINE static SizeT64 hashMix(SizeT64 hash) noexcept {
+        hash ^= (hash >> 33U);
+        hash *= 0xFF51AFD7ED558CCDULL;
+        hash ^= (hash >> 33U);
+        hash *= 0xC4CEB9FE1A85EC53ULL;
+        hash ^= (hash >> 33U);
+
+        return hash;
+    }
+
+    QENTEM_INLINE static SizeT64 hashCombine(SizeT64 seed, SizeT64 value) noexcept {
+        return hashMix(seed ^ (value + 0x9E3779B97F4A7C15ULL + (seed << 6U) + (seed >> 2U)));
+    }
+
+    // FNV-1a over the code units.
+    static SizeT64 hashString(const Char_T *str, SizeT length) noexcept {
+        SizeT64 hash = 0xCBF29CE484222325ULL;
+
+        for (SizeT offset = 0; offset < length; offset++) {
+            hash ^= static_cast<SizeT64>(str[offset]);
+            hash *= 0x100000001B3ULL;
+        }
+
+        return hashMix(hash);
+    }
+
+    // Drops this reference; the last one destroys the shared value.
+    void releaseShared() noexcept {
+        SharedBlock *block = sharedBlock();
+        is_shared_         = false;
+
+        if (Platform::AtomicDecrement(block->References) == 0) {
+            MemoryUtils::Destruct(block);
+            Reserver::Release(block, 1);
+        }
+    }
+
+    // Copy-on-write: called by everything that can change the value or hand out a way to.
+    QENTEM_INLINE void unshare() {
+        if (is_shared_ && isPtrValue()) {
+            detach();
+        }
+    }
+
+    QENTEM_NOINLINE void detach() {
+        SharedBlock *block = sharedBlock();
+
+        if (Platform::AtomicLoad(block->References) == SizeT32{1}) {
+            // The only reference; nobody else can copy it now, so take the content over.
+            is_shared_ = false;
+            setTypeToUndefined();
+            *this = QUtility::Move(block->Data);
+            MemoryUtils::Destruct(block);
+            Reserver::Release(block, 1);
+        } else {
+            // Copy before letting go, or another holder could release it in between.
+            is_shared_ = false;
+            setTypeToUndefined();
+            MemoryUtils::Construct(&array_);
+            copyValue(block->Data);
+
+            if (Platform::AtomicDecrement(block->References) == 0) {
+                MemoryUtils::Destruct(block);
+                Reserver::Release(block, 1);
+            }
+        }
+    }
+
     union {
         ArrayT       array_;
         ObjectT      object_;
@@ -2559,6 +3377,14 @@ struct Value {
     };
 
     ValueType type_{ValueType::Undefined};
+    bool      is_shared_{false}; // A ValuePtr that holds a reference to a SharedBlock.
+};
+
+template <typename Char_T>
+struct Value<Char_T>::SharedBlock {
+    Value   Data;
+    SizeT32 References;
+    SizeT64 Hash; // Of Data, or zero until first asked for; Data cannot change while shared.
 };
 
 } // namespace Qentem
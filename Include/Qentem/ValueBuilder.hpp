@@ -0,0 +1,126 @@
+/**
+ * @file ValueBuilder.hpp
+ * @brief Builds arrays of objects that share one set of keys, such as database rows.
+ *
+ * Filling rows through operator[] grows each object's table a step at a time and hashes
+ * every key again for every row. ValueBuilder takes the keys once: their hashes are computed
+ * up front, each row's object is reserved at the capacity the keys need, and the array of
+ * rows at the number expected. A row then only has to have its values assigned:
+ *
+ *     const StringView<char> keys[] = {{"id", 2}, {"name", 4}};
+ *     KeyTable<char>         table;
+ *     ValueBuilder<char>     builder{table, keys, 2};
+ *
+ *     builder.Expect(count);
+ *
+ *     for (...) {
+ *         Value<char> &row = builder.AddRow();
+ *         row[0]           = id;   // Members in the order of the keys.
+ *         row[1]           = name;
+ *     }
+ *
+ *     Value<char> rows = builder.Take();
+ *
+ * The keys are interned in a KeyTable that the caller owns: every row borrows the table's
+ * one copy of each key, and keys short enough to fit inside a String are kept inline. The
+ * rows stay valid after the builder is gone, for as long as the table lives; one table can
+ * serve several builders, and JSON::ParseInterned() too. A copy of the rows holds its own
+ * keys. A key left without a value is skipped, as a removed one is.
+ *
+ * @copyright Copyright (c) 2026 Hani Ammar
+ * @license MIT
+ */
+
+#ifndef QENTEM_VALUE_BUILDER_H
+#define QENTEM_VALUE_BUILDER_H
+
+#include "Qentem/Value.hpp"
+#include "Qentem/KeyTable.hpp"
+
+namespace Qentem {
+
+template <typename Char_T>
+struct ValueBuilder {
+    using ValueT      = Value<Char_T>;
+    using ObjectT     = typename ValueT::ObjectT;
+    using ArrayT      = typename ValueT::ArrayT;
+    using StringT     = String<Char_T>;
+    using StringViewT = StringView<Char_T>;
+
+    ValueBuilder(KeyTable<Char_T> &table, const StringViewT *keys, SizeT count) : keys_{count} {
+        for (SizeT index = 0; index < count; index++) {
+            Key key;
+
+            key.Name = table.Key(keys[index].First(), keys[index].Length(), key.Hash);
+            keys_ += QUtility::Move(key);
+        }
+    }
+
+    ValueBuilder(const ValueBuilder &)            = delete;
+    ValueBuilder &operator=(const ValueBuilder &) = delete;
+    ~ValueBuilder()                               = default;
+
+    /**
+     * @brief Makes room for count more rows, so adding them does not grow the array.
+     */
+    QENTEM_INLINE void Expect(SizeT count) {
+        rows_.Expect(count);
+    }
+
+    /**
+     * @brief Appends a row with every key in place and no values yet.
+     *
+     * @return The row, to be filled by position (operator[](SizeT)) or by key.
+     */
+    ValueT &AddRow() {
+        ObjectT    object{keys_.Size()};
+        const Key *key = keys_.First();
+        const Key *end = keys_.End();
+
+        while (key != end) {
+            StringT name;
+
+            if (key->Name.IsBorrowed()) {
+                name.Borrow(key->Name.First(), key->Name.Length());
+            } else {
+                name.Write(key->Name.First(), key->Name.Length());
+            }
+
+            object.Get(QUtility::Move(name), key->Hash);
+            ++key;
+        }
+
+        rows_ += ValueT{QUtility::Move(object)};
+
+        return *(rows_.Last());
+    }
+
+    /**
+     * @brief Hands over the rows added so far as an array value; the keys stay for more rows.
+     */
+    ValueT Take() {
+        return ValueT{QUtility::Move(rows_)};
+    }
+
+    QENTEM_INLINE SizeT Columns() const noexcept {
+        return keys_.Size();
+    }
+
+    QENTEM_INLINE SizeT Rows() const noexcept {
+        return rows_.Size();
+    }
+
+  private:
+    // Inline, or borrowing the table's copy; AddRow() gives each row the same.
+    struct Key {
+        StringT Name{};
+        SizeT   Hash{0};
+    };
+
+    ArrayT     rows_{};
+    Array<Key> keys_;
+};
+
+} // namespace Qentem
+
+#endif
@@ -35,7 +35,7 @@ struct VariableTag {
     }
 
     QENTEM_INLINE VariableTag(VariableTag &&src) noexcept
-        : Count{src.Count}, Length{src.Length}, IDLength{src.IDLength}, Level{src.Level} {
+        : Count{src.Count}, Length{src.Length}, IDLength{src.IDLength}, Level{src.Level}, HoistID{src.HoistID} {
         if constexpr (sizeof(void *) >= sizeof(VariableInfo)) {
             List     = src.List;
             src.List = nullptr;
@@ -48,7 +48,7 @@ struct VariableTag {
     }
 
     QENTEM_INLINE VariableTag(const VariableTag &src)
-        : Count{src.Count}, Length{src.Length}, IDLength{src.IDLength}, Level{src.Level} {
+        : Count{src.Count}, Length{src.Length}, IDLength{src.IDLength}, Level{src.Level}, HoistID{src.HoistID} {
         if constexpr (sizeof(void *) >= sizeof(VariableInfo)) {
             List = src.List;
         } else {
@@ -93,6 +93,7 @@ struct VariableTag {
             Length   = src.Length;
             IDLength = src.IDLength;
             Level    = src.Level;
+            HoistID  = src.HoistID;
 
             src.Count = 0;
         }
@@ -129,6 +130,7 @@ struct VariableTag {
             Length   = src.Length;
             IDLength = src.IDLength;
             Level    = src.Level;
+            HoistID  = src.HoistID;
         }
 
         return *this;
@@ -139,10 +141,11 @@ struct VariableTag {
         VariableInfo  Info{};
     };
 
-    SizeT8 Count{0};    ///< Number of segments.
-    SizeT8 Length{0};   ///< Length of the entire tag variable identifier.
-    SizeT8 IDLength{0}; ///< Length of the loop tag variable identifier.
-    SizeT8 Level{0};    ///< Nesting level of the variable (for scopes).
+    SizeT8  Count{0};    ///< Number of segments.
+    SizeT8  Length{0};   ///< Length of the entire tag variable identifier.
+    SizeT8  IDLength{0}; ///< Length of the loop tag variable identifier.
+    SizeT8  Level{0};    ///< Nesting level of the variable (for scopes).
+    SizeT16 HoistID{0};  ///< One-based slot in the loop-invariant cache; zero when resolved every time.
 };
 
 } // namespace Tags
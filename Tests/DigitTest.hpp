@@ -33,6 +33,7 @@
 
 #include "Qentem/QTest.hpp"
 #include "Qentem/Digit.hpp"
+#include "Qentem/NumberCache.hpp"
 #include "Qentem/StringStream.hpp"
 
 namespace Qentem {
@@ -2344,6 +2345,82 @@ static void TestStringToNumber8(QTest &test) {
     test.IsEqual(d_number, 4.45014771701440227211481959342e-308, __LINE__);
 }
 
+static void TestStringToNumber9(QTest &test) {
+    const char *str      = nullptr;
+    double      d_number = 0;
+    SizeT64     u_number = 0;
+    SizeT64I    i_number = 0;
+    float       f_number = 0;
+    bool        valid;
+
+    str   = "12345678";
+    valid = StringToNumber(test, u_number, str);
+    test.IsTrue(valid, __LINE__);
+    test.IsEqual(u_number, 12345678ULL, __LINE__);
+
+    str   = "1234567890123";
+    valid = StringToNumber(test, u_number, str);
+    test.IsTrue(valid, __LINE__);
+    test.IsEqual(u_number, 1234567890123ULL, __LINE__);
+
+    str   = "18446744073709551615";
+    valid = StringToNumber(test, u_number, str);
+    test.IsTrue(valid, __LINE__);
+    test.IsEqual(u_number, 18446744073709551615ULL, __LINE__);
+
+    str   = "-9223372036854775807";
+    valid = StringToNumber(test, i_number, str);
+    test.IsTrue(valid, __LINE__);
+    test.IsEqual(i_number, -9223372036854775807LL, __LINE__);
+
+    str   = "1234567a9";
+    valid = StringToNumber(test, u_number, str);
+    test.IsFalse(valid, __LINE__);
+
+    str   = "1234567.89";
+    valid = StringToNumber(test, d_number, str);
+    test.IsTrue(valid, __LINE__);
+    test.IsEqual(d_number, 1234567.89, __LINE__);
+
+    str   = "1428571.42857143";
+    valid = StringToNumber(test, d_number, str);
+    test.IsTrue(valid, __LINE__);
+    test.IsEqual(d_number, 1428571.42857143, __LINE__);
+
+    str   = "0.333333333333333";
+    valid = StringToNumber(test, d_number, str);
+    test.IsTrue(valid, __LINE__);
+    test.IsEqual(d_number, 0.333333333333333, __LINE__);
+
+    str   = "-7.25";
+    valid = StringToNumber(test, d_number, str);
+    test.IsTrue(valid, __LINE__);
+    test.IsEqual(d_number, -7.25, __LINE__);
+
+    str   = "9007199254740993e-5";
+    valid = StringToNumber(test, d_number, str);
+    test.IsTrue(valid, __LINE__);
+    test.IsEqual(d_number, 9007199254740993e-5, __LINE__);
+
+    str   = "123456789e22";
+    valid = StringToNumber(test, d_number, str);
+    test.IsTrue(valid, __LINE__);
+    test.IsEqual(d_number, 123456789e22, __LINE__);
+
+    str   = "3.1415927";
+    valid = StringToNumber(test, f_number, str);
+    test.IsTrue(valid, __LINE__);
+    test.IsEqual(f_number, 3.1415927f, __LINE__);
+
+    u_number = 0;
+    Digit::FastStringToNumber(u_number, "12345678901234567", 17U);
+    test.IsEqual(u_number, 12345678901234567ULL, __LINE__);
+
+    SizeT32 index = 0;
+    Digit::FastStringToNumber(index, "123456789", 9U);
+    test.IsEqual(index, 123456789U, __LINE__);
+}
+
 static void TestHexStringToNumber1(QTest &test) {
     SizeT64     number;
     const char *hex = "";
@@ -5338,6 +5415,57 @@ static void TestFloatToString5(QTest &test, StringStream<char> &stream) {
 #endif
 }
 
+static void TestNumberCache(QTest &test, StringStream<char> &stream) {
+    using NumberCacheT = NumberCache<char>;
+
+    const Digit::RealFormatInfo semi{2U, Digit::RealFormatType::SemiFixed};
+    const Digit::RealFormatInfo fixed{2U, Digit::RealFormatType::Fixed};
+    const Digit::RealFormatInfo fixed3{3U, Digit::RealFormatType::Fixed};
+
+    NumberCacheT::Clear();
+
+    stream.Write('|');
+    NumberCacheT::Write(stream, 19.5, semi); // miss
+    stream.Write('|');
+    NumberCacheT::Write(stream, 19.5, semi); // hit
+    stream.Write('|');
+    NumberCacheT::Write(stream, 19.5, fixed);
+    stream.Write('|');
+    NumberCacheT::Write(stream, 19.5, fixed3);
+    stream.Write('|');
+    NumberCacheT::Write(stream, -0.0, semi);
+    stream.Write('|');
+    NumberCacheT::Write(stream, 0.0, semi);
+    test.IsEqual(stream, "|19.5|19.5|19.50|19.500|-0|0", __LINE__);
+    stream.Clear();
+
+    // Longer than an entry.
+    NumberCacheT::Write(stream, 1e30, fixed);
+    NumberCacheT::Write(stream, 1e30, fixed);
+    test.IsEqual(stream, "1000000000000000019884624838656.001000000000000000019884624838656.00", __LINE__);
+    stream.Clear();
+
+    // More numbers than entries; collisions must still write the right text.
+    StringStream<char> expected{};
+    SizeT32            round = 0;
+
+    while (round < 2U) {
+        SizeT32 index = 0;
+
+        while (index < (NumberCacheT::Size * 4U)) {
+            const double number = (double(index) + 0.25);
+            NumberCacheT::Write(stream, number, semi);
+            Digit::NumberToString(expected, number, semi);
+            ++index;
+        }
+
+        ++round;
+    }
+
+    test.IsTrue(stream == expected, __LINE__);
+    stream.Clear();
+}
+
 static int RunDigitTests() {
     QTest test{"Digit.hpp", __FILE__};
 
@@ -5352,6 +5480,7 @@ static int RunDigitTests() {
     test.Test("StringToNumber Test 6", TestStringToNumber6);
     test.Test("StringToNumber Test 7", TestStringToNumber7);
     test.Test("StringToNumber Test 8", TestStringToNumber8);
+    test.Test("StringToNumber Test 9", TestStringToNumber9);
 
     test.Test("HexStringToNumber Test 1", TestHexStringToNumber1);
     test.Test("HexStringToNumber Test 2", TestHexStringToNumber2);
@@ -5372,6 +5501,7 @@ static int RunDigitTests() {
 
     test.Test("DoubleToStringSemiFixed Test 3", TestDoubleToStringSemiFixed, false, stream);
     test.Test("DoubleToStringFixed Test 3", TestDoubleToStringFixed, false, stream);
+    test.Test("NumberCache Test", TestNumberCache, false, stream);
 
     test.Test("FloatToString Test 1", TestFloatToString1, false, stream);
     test.Test("FloatToString Test 2", TestFloatToString2, false, stream);
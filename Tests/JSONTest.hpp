@@ -25,6 +25,8 @@
 
 #include "Qentem/QTest.hpp"
 #include "Qentem/JSON.hpp"
+#include "Qentem/JSONIndex.hpp"
+#include "Qentem/JSONPushParser.hpp"
 
 namespace Qentem {
 namespace Test {
@@ -1855,6 +1857,1066 @@ static void TestParse9(QTest &test) {
     test.IsTrue(value.IsUndefined(), __LINE__);
 }
 
+static void TestParse10(QTest &test) {
+    // Documents that cross the 64-byte blocks and the buffer of JSONIndex. A path set that selects
+    // everything builds through the index, so it must agree with the plain parser.
+    Value<char>        value;
+    Value<char>        expected;
+    StringStream<char> stream;
+    StringStream<char> stream2;
+    StringStream<char> content;
+    JSONPaths<char>    whole;
+    SizeT              i;
+
+    whole.Add("a");
+    whole.Add("[*]");
+
+    content += R"({"a":[)";
+
+    i = 0;
+    while (i < 300) {
+        if (i != 0) {
+            content += R"(,)";
+        }
+
+        content += R"({"id":)";
+        Digit::NumberToString(content, i);
+        content += R"(,"name":"item\"\\\\)";
+        Digit::NumberToString(content, i * 7);
+        content += R"( A \n",   "v":[true,false,null,-1.5e2, 0.25]})";
+        ++i;
+    }
+
+    content += R"(]})";
+
+    value    = JSON::Parse(stream, content.First(), content.Length(), whole);
+    expected = JSON::Parse(stream, content.First(), content.Length());
+    test.IsFalse(value.IsUndefined(), __LINE__);
+    test.IsEqual(value.Stringify(stream), expected.Stringify(stream2), __LINE__);
+    test.IsEqual(value["a"].Size(), 300U, __LINE__);
+    test.IsEqual(value["a"][299]["name"].GetString()->Length(), 15U, __LINE__);
+
+    // Backslash runs and quotes on every block boundary.
+    content.Clear();
+    content += R"([")";
+
+    i = 0;
+    while (i < 500) {
+        content += R"(\\)";
+
+        if ((i % 3) == 0) {
+            content += R"(\")";
+        }
+
+        if ((i % 5) == 0) {
+            content += R"(",")";
+        }
+
+        ++i;
+    }
+
+    content += R"("])";
+
+    stream.Clear();
+    stream2.Clear();
+    value    = JSON::Parse(stream, content.First(), content.Length(), whole);
+    expected = JSON::Parse(stream, content.First(), content.Length());
+    test.IsFalse(value.IsUndefined(), __LINE__);
+    test.IsEqual(value.Stringify(stream), expected.Stringify(stream2), __LINE__);
+    test.IsEqual(value.Size(), 101U, __LINE__);
+
+    stream.Clear();
+
+    // Long whitespace and strings with no tokens for a whole fill.
+    content.Clear();
+    content += R"({"k":)";
+
+    i = 0;
+    while (i < 2000) {
+        content += " ";
+        ++i;
+    }
+
+    content += R"(")";
+
+    i = 0;
+    while (i < 2000) {
+        content += "x";
+        ++i;
+    }
+
+    content += R"("}  )";
+
+    whole.Add("k");
+
+    value = JSON::Parse(stream, content.First(), content.Length());
+    test.IsTrue(value.IsObject(), __LINE__);
+    test.IsEqual(value["k"].GetString()->Length(), 2000U, __LINE__);
+
+    value = JSON::Parse(stream, content.First(), content.Length(), whole);
+    test.IsTrue(value.IsObject(), __LINE__);
+    test.IsEqual(value["k"].GetString()->Length(), 2000U, __LINE__);
+
+    // Rejections still hold on large input.
+    content += R"(,)";
+    value = JSON::Parse(stream, content.First(), content.Length());
+    test.IsTrue(value.IsUndefined(), __LINE__);
+
+    value = JSON::Parse(stream, content.First(), content.Length(), whole);
+    test.IsTrue(value.IsUndefined(), __LINE__);
+
+    content.Clear();
+    content += R"([")";
+
+    i = 0;
+    while (i < 100) {
+        content += "abc";
+        ++i;
+    }
+
+    content += "\t\"]";
+    value = JSON::Parse(stream, content.First(), content.Length());
+    test.IsTrue(value.IsUndefined(), __LINE__);
+
+    value = JSON::Parse(stream, content.First(), content.Length(), whole);
+    test.IsTrue(value.IsUndefined(), __LINE__);
+}
+
+// The tokens JSONIndex should yield for valid JSON, found one character at a time.
+static void JSONIndexTokens(const char *content, SizeT length, Array<SizeT> &tokens) {
+    bool  in_string = false;
+    bool  escaped   = false;
+    bool  in_scalar = false;
+    SizeT offset    = 0;
+
+    while (offset < length) {
+        const char ch         = content[offset];
+        const bool is_control = ((ch == '\n') || (ch == '\t') || (ch == '\r'));
+
+        if (in_string) {
+            if (escaped) {
+                escaped = false;
+
+                if ((ch == '\\') || is_control) {
+                    tokens += offset;
+                }
+            } else if ((ch == '\\') || is_control) {
+                tokens += offset;
+                escaped = (ch == '\\');
+            } else if (ch == '"') {
+                tokens += offset;
+                in_string = false;
+            }
+        } else {
+            switch (ch) {
+                case '"': {
+                    tokens += offset;
+                    in_string = true;
+                    in_scalar = false;
+                    break;
+                }
+
+                case '{':
+                case '}':
+                case '[':
+                case ']':
+                case ':':
+                case ',': {
+                    tokens += offset;
+                    in_scalar = false;
+                    break;
+                }
+
+                case ' ':
+                case '\n':
+                case '\t':
+                case '\r': {
+                    in_scalar = false;
+                    break;
+                }
+
+                default: {
+                    if (!in_scalar) {
+                        tokens += offset;
+                        in_scalar = true;
+                    }
+                }
+            }
+        }
+
+        ++offset;
+    }
+}
+
+static void CheckJSONIndex(QTest &test, const StringStream<char> &content, unsigned long line) {
+    JSONIndex<char> index{content.First(), content.Length()};
+    Array<SizeT>    expected;
+    Array<SizeT>    tokens;
+    SizeT           offset;
+
+    JSONIndexTokens(content.First(), content.Length(), expected);
+
+    while ((offset = index.Current()) != content.Length()) {
+        tokens += offset;
+        index.Next();
+    }
+
+    test.IsEqual(tokens.Size(), expected.Size(), line);
+
+    offset = 0;
+
+    while ((offset < tokens.Size()) && (offset < expected.Size())) {
+        test.IsEqual(tokens.First()[offset], expected.First()[offset], line);
+        ++offset;
+    }
+}
+
+static void TestJSONIndex(QTest &test) {
+    // Documents that cross the 64-byte blocks and the token buffer of JSONIndex, against a
+    // character-by-character scan.
+    StringStream<char> content;
+    SizeT              i;
+
+    content += R"({"a":[)";
+
+    i = 0;
+    while (i < 300) {
+        if (i != 0) {
+            content += R"(,)";
+        }
+
+        content += R"({"id":)";
+        Digit::NumberToString(content, i);
+        content += R"(,"name":"item\"\\\\)";
+        Digit::NumberToString(content, i * 7);
+        content += R"( A \n",   "v":[true,false,null,-1.5e2, 0.25]})";
+        ++i;
+    }
+
+    content += R"(]})";
+    CheckJSONIndex(test, content, __LINE__);
+
+    // Backslash runs and quotes on every block boundary.
+    content.Clear();
+    content += R"([")";
+
+    i = 0;
+    while (i < 500) {
+        content += R"(\\)";
+
+        if ((i % 3) == 0) {
+            content += R"(\")";
+        }
+
+        if ((i % 5) == 0) {
+            content += R"(",")";
+        }
+
+        ++i;
+    }
+
+    content += R"("])";
+    CheckJSONIndex(test, content, __LINE__);
+
+    // An escape or a quote at each position around the end of the first block.
+    i = 50;
+    while (i < 70) {
+        content.Clear();
+        content += R"([")";
+
+        SizeT pad = 2;
+        while (pad < i) {
+            content += "a";
+            ++pad;
+        }
+
+        content += R"(\"\\",")";
+        content += R"(\\\"a"])";
+        CheckJSONIndex(test, content, __LINE__);
+        ++i;
+    }
+
+    // Scalars split across blocks.
+    content.Clear();
+    content += R"([)";
+
+    i = 0;
+    while (i < 200) {
+        if (i != 0) {
+            content += R"(,)";
+        }
+
+        SizeT spaces = (i % 7);
+        while (spaces != 0) {
+            content += " ";
+            --spaces;
+        }
+
+        Digit::NumberToString(content, (i * 7919));
+
+        if ((i % 4) == 0) {
+            content += R"(,true,null,-0.5e10)";
+        }
+
+        ++i;
+    }
+
+    content += R"(])";
+    CheckJSONIndex(test, content, __LINE__);
+
+    // Long whitespace and strings with no tokens for a whole fill.
+    content.Clear();
+    content += R"({"k":)";
+
+    i = 0;
+    while (i < 2000) {
+        content += " ";
+        ++i;
+    }
+
+    content += R"(")";
+
+    i = 0;
+    while (i < 2000) {
+        content += "x";
+        ++i;
+    }
+
+    content += R"("}  )";
+    CheckJSONIndex(test, content, __LINE__);
+
+    // Line controls inside a string are reported.
+    content.Clear();
+    content += R"([")";
+
+    i = 0;
+    while (i < 100) {
+        content += "abc";
+        ++i;
+    }
+
+    content += "\t\"]";
+    CheckJSONIndex(test, content, __LINE__);
+}
+
+static void TestParseBorrowed(QTest &test) {
+    Value<char>        value;
+    Value<char>        copy;
+    StringStream<char> stream;
+    const char        *content;
+
+    content = R"({"name":"Qentem","esc":"a\"b","list":["x","y\n",1,true],"deep":{"k":"v"}})";
+    value   = JSON::ParseBorrowed(stream, content, StringUtils::Count(content));
+    test.IsTrue(value.IsObject(), __LINE__);
+    test.IsEqual(value.Stringify(stream), content, __LINE__);
+
+    // Unescaped strings and keys point into the content.
+    test.IsTrue(value["name"].GetString()->IsBorrowed(), __LINE__);
+    test.IsEqual(value["name"].GetString()->First(), (content + 9), __LINE__);
+    test.IsTrue(value.GetKeyAt(0)->IsBorrowed(), __LINE__);
+    test.IsTrue(value["list"][0].GetString()->IsBorrowed(), __LINE__);
+    test.IsTrue(value["deep"]["k"].GetString()->IsBorrowed(), __LINE__);
+
+    // Escaped ones are copied.
+    test.IsFalse(value["esc"].GetString()->IsBorrowed(), __LINE__);
+    test.IsEqual(value["esc"].GetStringView(), R"(a"b)", __LINE__);
+    test.IsFalse(value["list"][1].GetString()->IsBorrowed(), __LINE__);
+
+    // Copies own their text.
+    copy = value;
+    test.IsFalse(copy["name"].GetString()->IsBorrowed(), __LINE__);
+    test.IsEqual(copy["name"].GetStringView(), "Qentem", __LINE__);
+
+    *(value["name"].GetString()) += "!";
+    test.IsEqual(value["name"].GetStringView(), "Qentem!", __LINE__);
+    test.IsFalse(value["name"].GetString()->IsBorrowed(), __LINE__);
+
+    for (char &ch : *(value["deep"]["k"].GetString())) {
+        ch = 'w';
+    }
+
+    test.IsEqual(value["deep"]["k"].GetStringView(), "w", __LINE__);
+    test.IsFalse(value["deep"]["k"].GetString()->IsBorrowed(), __LINE__);
+    test.IsEqual(copy["deep"]["k"].GetStringView(), "v", __LINE__);
+
+    stream.Clear();
+    content = R"(["", "a", "\u0041", {"": ""}])";
+    value   = JSON::ParseBorrowed(stream, content, StringUtils::Count(content));
+    stream.Clear();
+    test.IsEqual(value.Stringify(stream), R"(["","a","A",{"":""}])", __LINE__);
+    test.IsTrue(value[1].GetString()->IsBorrowed(), __LINE__);
+    test.IsFalse(value[2].GetString()->IsBorrowed(), __LINE__);
+
+    stream.Clear();
+    content = R"(["a",])";
+    value   = JSON::ParseBorrowed(stream, content, StringUtils::Count(content));
+    test.IsTrue(value.IsUndefined(), __LINE__);
+}
+
+
+static void TestParseInterned(QTest &test) {
+    Value<char>        value;
+    Value<char>        other;
+    Value<char>        copy;
+    KeyTable<char>     keys;
+    StringStream<char> stream;
+    const char        *content;
+
+    content = R"([{"id":1,"customer_name":"a","status_code_value":"x"},)"
+              R"({"id":2,"customer_name":"b","status_code_value":"y"},)"
+              R"({"id":3,"customer\u005fname":"c","extra":{"customer_name":null}}])";
+    value   = JSON::ParseInterned(stream, content, StringUtils::Count(content), keys);
+    test.IsTrue(value.IsArray(), __LINE__);
+    test.IsEqual(value.Stringify(stream),
+                 R"([{"id":1,"customer_name":"a","status_code_value":"x"},)"
+                 R"({"id":2,"customer_name":"b","status_code_value":"y"},)"
+                 R"({"id":3,"customer_name":"c","extra":{"customer_name":null}}])",
+                 __LINE__);
+    stream.Clear();
+
+    // Long keys are kept once, escaped ones included; short ones stay inline.
+    test.IsEqual(keys.Size(), SizeT{2}, __LINE__);
+    test.IsTrue(value[0].GetKeyAt(1)->IsBorrowed(), __LINE__);
+    test.IsEqual(value[0].GetKeyAt(1)->First(), value[1].GetKeyAt(1)->First(), __LINE__);
+    test.IsEqual(value[0].GetKeyAt(1)->First(), value[2].GetKeyAt(1)->First(), __LINE__);
+    test.IsEqual(value[0].GetKeyAt(1)->First(), value[2]["extra"].GetKeyAt(0)->First(), __LINE__);
+    test.IsTrue(value[0].GetKeyAt(0)->IsInline(), __LINE__);
+    test.IsEqual(value[2]["customer_name"].GetStringView(), "c", __LINE__);
+    test.IsNotNull(value[1].GetValue("status_code_value", 17), __LINE__);
+
+    // Later parses share the same copies.
+    content = R"({"customer_name":"d"})";
+    other   = JSON::ParseInterned(content, StringUtils::Count(content), keys);
+    test.IsEqual(keys.Size(), SizeT{2}, __LINE__);
+    test.IsEqual(other.GetKeyAt(0)->First(), value[0].GetKeyAt(1)->First(), __LINE__);
+
+    // Copies own their keys.
+    copy = value;
+    test.IsFalse(copy[0].GetKeyAt(1)->IsBorrowed(), __LINE__);
+    test.IsTrue(copy.Equals(value), __LINE__);
+
+    // Without the structural index.
+    Value<char16_t>    value16;
+    KeyTable<char16_t> keys16;
+    const char16_t    *content16 = uR"([{"a_long_key_name":1},{"a_long_key_name":2}])";
+
+    value16 = JSON::ParseInterned(content16, StringUtils::Count(content16), keys16);
+    test.IsEqual(keys16.Size(), SizeT{1}, __LINE__);
+    test.IsEqual(value16[0].GetKeyAt(0)->First(), value16[1].GetKeyAt(0)->First(), __LINE__);
+    test.IsEqual(value16[1].GetValueAt(0)->GetUInt64(), SizeT64{2}, __LINE__);
+}
+// SplitMix64; the same seed gives the same documents and splits on every platform.
+static SizeT64 JSONFuzzNext(SizeT64 &state) noexcept {
+    SizeT64 value = (state += 0x9E3779B97F4A7C15ULL);
+    value         = ((value ^ (value >> 30U)) * 0xBF58476D1CE4E5B9ULL);
+    value         = ((value ^ (value >> 27U)) * 0x94D049BB133111EBULL);
+    return (value ^ (value >> 31U));
+}
+
+static SizeT JSONFuzzBelow(SizeT64 &state, SizeT limit) noexcept {
+    return static_cast<SizeT>(JSONFuzzNext(state) % limit);
+}
+
+static void JSONFuzzDocument(SizeT64 &state, StringStream<char> &content, SizeT depth) {
+    static constexpr const char *scalars[] = {
+        R"("abc")",    R"("a\"b")",          R"("\\")",    R"("x\ny\t\/\b\f\r")", R"("\u0041")",
+        R"("\u00e9")", R"("\uD83D\uDE00")", R"("\ullb")", R"("\u00"\\"e9x")",    R"("\uD8"\"A")",
+        R"("")",       "123",                "-1.5e3",     "0.125",                "true",
+        "false",       "null",               "-0"};
+
+    const bool is_object = ((JSONFuzzBelow(state, 2) == 0) && (depth != 0));
+    SizeT      count     = JSONFuzzBelow(state, 4);
+
+    content += (is_object ? "{" : "[");
+
+    while (count != 0) {
+        if (is_object) {
+            content += scalars[JSONFuzzBelow(state, 11)];
+            content += ":";
+        }
+
+        if ((depth < 3) && (JSONFuzzBelow(state, 4) == 0)) {
+            JSONFuzzDocument(state, content, (depth + 1));
+        } else {
+            content += scalars[JSONFuzzBelow(state, (sizeof(scalars) / sizeof(scalars[0])))];
+        }
+
+        --count;
+
+        if (count != 0) {
+            content += ((JSONFuzzBelow(state, 3) == 0) ? " , " : ",");
+        }
+    }
+
+    content += (is_object ? "}" : "]");
+}
+
+// Feeds content in random chunks; the push parser has to accept and build exactly what JSON::Parse does.
+static void CheckPushParser(QTest &test, JSONPushParser<char> &parser, SizeT64 &state, const char *content,
+                            SizeT length, unsigned long line) {
+    StringStream<char> expected;
+    StringStream<char> stream;
+    const Value<char>  value    = JSON::Parse(content, length);
+    const bool         accepted = !(value.IsUndefined());
+    SizeT              offset   = 0;
+
+    if (accepted) {
+        value.Stringify(expected);
+    }
+
+    parser.Reset();
+
+    while (offset < length) {
+        SizeT size = (JSONFuzzBelow(state, 9) + SizeT{1});
+
+        if (size > (length - offset)) {
+            size = (length - offset);
+        }
+
+        parser.Feed((content + offset), size);
+        offset += size;
+    }
+
+    test.IsEqual(parser.Finish(), accepted, line);
+
+    if (accepted) {
+        parser.GetValue().Stringify(stream);
+        test.IsEqual(stream, expected, line);
+    }
+}
+
+static void TestPushParserFuzz(QTest &test) {
+    static constexpr const char *marks = R"("\\u{}[],: 0D8E)";
+
+    JSONPushParser<char> parser;
+    StringStream<char>   content;
+    SizeT64              state = 0x5EED;
+    SizeT                i     = 0;
+    SizeT                split;
+
+    // Strings that end where only an UnEscape()-style scan ends them.
+    const char *cases[] = {R"(["\ullb"])", R"(["\u00"\\"e9x"])", R"(["\uD8"\"A"])", R"(["\uD800"])",
+                           R"({"\u00"x":"\u"]"})", R"(["a\)", R"(["\q"])", "[\"a\tb\"]"};
+
+    for (const char *item : cases) {
+        split = 0;
+
+        while (split < 8) {
+            CheckPushParser(test, parser, state, item, StringUtils::Count(item), __LINE__);
+            ++split;
+        }
+    }
+
+    while (i < 3000) {
+        content.Clear();
+        JSONFuzzDocument(state, content, 0);
+
+        // Most documents stay valid; the rest get a few characters inserted, removed or replaced.
+        split = JSONFuzzBelow(state, 4);
+
+        while ((split != 0) && (content.Length() > 1)) {
+            const SizeT at   = JSONFuzzBelow(state, content.Length());
+            const char  mark = marks[JSONFuzzBelow(state, StringUtils::Count(marks))];
+            StringStream<char> edited;
+
+            edited.Write(content.First(), at);
+
+            switch (JSONFuzzBelow(state, 3)) {
+                case 0: {
+                    edited += mark;
+                    edited.Write((content.First() + at), (content.Length() - at));
+                    break;
+                }
+
+                case 1: {
+                    edited.Write((content.First() + at + 1), (content.Length() - at - 1));
+                    break;
+                }
+
+                default: {
+                    edited += mark;
+                    edited.Write((content.First() + at + 1), (content.Length() - at - 1));
+                }
+            }
+
+            content = QUtility::Move(edited);
+            --split;
+        }
+
+        CheckPushParser(test, parser, state, content.First(), content.Length(), __LINE__);
+        ++i;
+    }
+}
+
+static void TestPushParser(QTest &test) {
+    StringStream<char>   stream;
+    StringStream<char>   expected;
+    JSONPushParser<char> parser;
+    Value<char>          value;
+    const char          *content;
+    SizeT                length;
+    SizeT                cut;
+
+    // Every split point, including mid-string, mid-escape, mid-number and mid-literal.
+    content = R"( {"a":1,"b":[true,false,null,-1.5e3,"x\"y\\z\u0041\uD83D\uDE00"],"c":{"d":{}},"e":[]} )";
+    length  = StringUtils::Count(content);
+    JSON::Parse(content, length).Stringify(expected);
+
+    cut = 0;
+    while (cut <= length) {
+        test.IsTrue(parser.Feed(content, cut), __LINE__);
+        test.IsTrue(parser.Feed((content + cut), (length - cut)), __LINE__);
+        test.IsTrue(parser.Finish(), __LINE__);
+
+        value = parser.TakeValue();
+        stream.Clear();
+        test.IsEqual(value.Stringify(stream), expected, __LINE__);
+        ++cut;
+    }
+
+    // One byte at a time.
+    cut = 0;
+    while (cut < length) {
+        parser.Feed((content + cut), 1);
+        ++cut;
+    }
+
+    test.IsTrue(parser.Finish(), __LINE__);
+    value = parser.TakeValue();
+    stream.Clear();
+    test.IsEqual(value.Stringify(stream), expected, __LINE__);
+
+    content = R"([123456789012 , -42,0.125, "" ,[{"k" : "v"}]])";
+    parser.Feed(content, 8);
+    test.IsFalse(parser.IsDone(), __LINE__);
+    parser.Feed((content + 8), (StringUtils::Count(content) - 8));
+    test.IsTrue(parser.IsDone(), __LINE__);
+    test.IsTrue(parser.Finish(), __LINE__);
+    stream.Clear();
+    test.IsEqual(parser.GetValue().Stringify(stream), R"([123456789012,-42,0.125,"",[{"k":"v"}]])", __LINE__);
+    parser.Reset();
+
+    // Incomplete and invalid input.
+    content = R"({"a":[1,2)";
+    test.IsTrue(parser.Feed(content, StringUtils::Count(content)), __LINE__);
+    test.IsFalse(parser.Finish(), __LINE__);
+    test.IsTrue(parser.GetValue().IsUndefined(), __LINE__);
+    parser.Reset();
+
+    content = R"({"a":1,})";
+    test.IsFalse(parser.Feed(content, StringUtils::Count(content)), __LINE__);
+    test.IsTrue(parser.IsFailed(), __LINE__);
+    test.IsFalse(parser.Feed("{}", 2), __LINE__);
+    test.IsFalse(parser.Finish(), __LINE__);
+    parser.Reset();
+
+    content = R"([1 2])";
+    test.IsFalse(parser.Feed(content, StringUtils::Count(content)), __LINE__);
+    parser.Reset();
+
+    test.IsTrue(parser.Feed("[tr", 3), __LINE__);
+    test.IsFalse(parser.Feed("e]", 2), __LINE__);
+    parser.Reset();
+
+    test.IsTrue(parser.Feed("[1]", 3), __LINE__);
+    test.IsFalse(parser.Feed(" x", 2), __LINE__);
+    parser.Reset();
+
+    test.IsTrue(parser.Feed(R"(["a\)", 4), __LINE__);
+    test.IsFalse(parser.Feed(R"(q"])", 3), __LINE__);
+    parser.Reset();
+
+    test.IsFalse(parser.Feed("1", 1), __LINE__);
+    parser.Reset();
+
+    test.IsFalse(parser.Finish(), __LINE__);
+}
+
+template <typename Char_T>
+struct JSONTestRecorder : JSONHandler<Char_T> {
+    bool OnStartObject() {
+        Events += "{";
+        return true;
+    }
+
+    bool OnEndObject() {
+        Events += "}";
+        return true;
+    }
+
+    bool OnStartArray() {
+        Events += "[";
+        return true;
+    }
+
+    bool OnEndArray() {
+        Events += "]";
+        return true;
+    }
+
+    bool OnKey(const Char_T *, SizeT length) {
+        Events += "K";
+        Digit::NumberToString(Events, length);
+        return true;
+    }
+
+    bool OnString(const Char_T *, SizeT length) {
+        Events += "S";
+        Digit::NumberToString(Events, length);
+        return true;
+    }
+
+    bool OnNumber(const QNumber64 &number, QNumberType type) {
+        switch (type) {
+            case QNumberType::Natural: {
+                Events += "U";
+                Digit::NumberToString(Events, number.Natural);
+                break;
+            }
+
+            case QNumberType::Integer: {
+                Events += "I";
+                Digit::NumberToString(Events, number.Integer);
+                break;
+            }
+
+            default: {
+                Events += "D";
+                Digit::NumberToString(Events, number.Real);
+            }
+        }
+
+        return true;
+    }
+
+    bool OnBool(bool value) {
+        Events += (value ? "T" : "F");
+        return true;
+    }
+
+    bool OnNull() {
+        Events += "N";
+        return true;
+    }
+
+    StringStream<char> Events;
+};
+
+struct JSONTestCounter : JSONHandler<char> {
+    bool OnKey(const char *key, SizeT length) {
+        is_id_ = StringUtils::IsEqual(key, "id", 2) && (length == 2);
+        return true;
+    }
+
+    bool OnNumber(const QNumber64 &number, QNumberType) {
+        if (is_id_) {
+            Sum += number.Natural;
+            ++Count;
+        }
+
+        return (Count != Limit);
+    }
+
+    SizeT64 Sum{0};
+    SizeT   Count{0};
+    SizeT   Limit{0};
+
+  private:
+    bool is_id_{false};
+};
+
+// Records only what is outside containers of the "skip" member.
+struct JSONTestSkipper : JSONTestRecorder<char> {
+    bool OnKey(const char *key, SizeT length) {
+        skip_ = StringUtils::IsEqual(key, "skip", 4) && (length == 4);
+        return JSONTestRecorder<char>::OnKey(key, length);
+    }
+
+    bool SkipValue(bool is_container) {
+        const bool skip = (skip_ && is_container);
+        skip_           = false;
+        return skip;
+    }
+
+  private:
+    bool skip_{false};
+};
+
+static void TestWalk(QTest &test) {
+    JSONTestRecorder<char> recorder;
+    const char            *content;
+
+    content = R"( {"a":1,"bb":[true,false,null,-15,0.5,"x\"y"],"c":{"d":{}},"e":[]} )";
+    test.IsTrue(JSON::Walk(recorder, content, StringUtils::Count(content)), __LINE__);
+    test.IsEqual(recorder.Events, "{K1U1K2[TFNI-15D0.5S3]K1{K1{}}K1[]}", __LINE__);
+
+    recorder.Events.Clear();
+    content = R"({"a":[1,2,]})";
+    test.IsFalse(JSON::Walk(recorder, content, StringUtils::Count(content)), __LINE__);
+
+    content = R"([1] 2)";
+    test.IsFalse(JSON::Walk(recorder, content, StringUtils::Count(content)), __LINE__);
+
+    content = R"("a")";
+    test.IsFalse(JSON::Walk(recorder, content, StringUtils::Count(content)), __LINE__);
+
+    content = R"({"a" 1})";
+    test.IsFalse(JSON::Walk(recorder, content, StringUtils::Count(content)), __LINE__);
+
+    content = R"([tru])";
+    test.IsFalse(JSON::Walk(recorder, content, StringUtils::Count(content)), __LINE__);
+
+    JSONTestCounter counter;
+    content = R"([{"id":1,"name":"a"},{"id":2,"v":[3]},{"name":"c","id":4}])";
+    test.IsTrue(JSON::Walk(counter, content, StringUtils::Count(content)), __LINE__);
+    test.IsEqual(counter.Sum, SizeT64{7}, __LINE__);
+    test.IsEqual(counter.Count, SizeT{3}, __LINE__);
+
+    // Stopping early.
+    JSONTestCounter counter2;
+    counter2.Limit = 2;
+    test.IsFalse(JSON::Walk(counter2, content, StringUtils::Count(content)), __LINE__);
+    test.IsEqual(counter2.Sum, SizeT64{3}, __LINE__);
+
+    // Skipped values are stepped over unread, but must still balance.
+    JSONTestSkipper skipper;
+    content = R"({"skip":{"a":[1,"]}"],"b":tru},"x":[{"skip":[]},{"skip":1}]})";
+    test.IsTrue(JSON::Walk(skipper, content, StringUtils::Count(content)), __LINE__);
+    test.IsEqual(skipper.Events, "{K4K1[{K4}{K4U1}]}", __LINE__);
+
+    skipper.Events.Clear();
+    content = R"({"skip":[[1]})";
+    test.IsFalse(JSON::Walk(skipper, content, StringUtils::Count(content)), __LINE__);
+
+    JSONTestRecorder<char16_t> recorder16;
+    const char16_t *content16 = u"[\"ab\",{\"k\":7}]";
+    test.IsTrue(JSON::Walk(recorder16, content16, StringUtils::Count(content16)), __LINE__);
+    test.IsEqual(recorder16.Events, "[S2{K1U7}]", __LINE__);
+}
+
+static void TestParsePaths(QTest &test) {
+    JSONPaths<char>    paths;
+    Value<char>        value;
+    StringStream<char> stream;
+    const char        *content;
+
+    test.IsTrue(paths.Add("items[*].price"), __LINE__);
+    test.IsTrue(paths.Add("meta.id"), __LINE__);
+    test.IsTrue(paths.Add("rows[1]"), __LINE__);
+    test.IsTrue(paths.Add("rows[1].x"), __LINE__); // Already selected whole.
+    test.IsTrue(paths.Add("grid[0][*]"), __LINE__);
+    test.IsTrue(paths.Add("esc\"key"), __LINE__);
+
+    test.IsFalse(paths.Add(""), __LINE__);
+    test.IsFalse(paths.Add("a..b"), __LINE__);
+    test.IsFalse(paths.Add("a."), __LINE__);
+    test.IsFalse(paths.Add(".a"), __LINE__);
+    test.IsFalse(paths.Add("a[]"), __LINE__);
+    test.IsFalse(paths.Add("a[x]"), __LINE__);
+    test.IsFalse(paths.Add("a[1"), __LINE__);
+    test.IsFalse(paths.Add("a[1]b"), __LINE__);
+    test.IsFalse(paths.Add("a]"), __LINE__);
+    test.IsFalse(paths.Add("a[99999999999999999999]"), __LINE__); // Too large for SizeT.
+
+    content = R"({
+        "skip": {"a": [1, {"b": "x\"}]"}, "c": "]]}}"}, "d": [[[]]]},
+        "items": [
+            {"name": "one", "price": 1.5, "tags": ["a", "b"]},
+            {"name": "tw\"o", "price": {"value": 2, "currency": "USD"}},
+            {"name": "three"},
+            "not an object",
+            7
+        ],
+        "meta": {"id": "m-1", "count": 3, "id2": 5},
+        "rows": [{"x": 1}, {"x": 2, "y": [true, null]}, {"x": 3}],
+        "grid": [[1, 2], [3, 4]],
+        "esc\"key": false,
+        "tail": tru
+    })";
+
+    value = JSON::Parse(stream, content, StringUtils::Count(content), paths);
+    test.IsTrue(value.IsObject(), __LINE__);
+    test.IsEqual(value.Stringify(stream),
+                 R"({"items":[{"price":1.5},{"price":{"value":2,"currency":"USD"}},{}],"meta":{"id":"m-1"},)"
+                 R"("rows":[{"x":2,"y":[true,null]}],"grid":[[1,2]],"esc\"key":false})",
+                 __LINE__);
+
+    // Skipped parts are only checked for balanced brackets and quotes; selected parts fully.
+    content = R"({"meta": {"id": tru}})";
+    value   = JSON::Parse(stream, content, StringUtils::Count(content), paths);
+    test.IsTrue(value.IsUndefined(), __LINE__);
+
+    content = R"({"skip": [1, {"a": 2}, "x"})";
+    value   = JSON::Parse(stream, content, StringUtils::Count(content), paths);
+    test.IsTrue(value.IsUndefined(), __LINE__);
+
+    content = R"({"skip": "abc})";
+    value   = JSON::Parse(stream, content, StringUtils::Count(content), paths);
+    test.IsTrue(value.IsUndefined(), __LINE__);
+
+    content = R"({"meta": {"id": 1},})";
+    value   = JSON::Parse(stream, content, StringUtils::Count(content), paths);
+    test.IsTrue(value.IsUndefined(), __LINE__);
+
+    content = R"([{"price": 1}])";
+    value   = JSON::Parse(stream, content, StringUtils::Count(content), paths);
+    stream.Clear();
+    test.IsEqual(value.Stringify(stream), R"([])", __LINE__);
+
+    // An exact position and [*] both apply to that position, whichever is added first.
+    content = R"({"items": [{"id": 1, "price": 10, "x": 0}, {"id": 2, "price": 20}]})";
+
+    JSONPaths<char> exact_first;
+    test.IsTrue(exact_first.Add("items[0].id"), __LINE__);
+    test.IsTrue(exact_first.Add("items[*].price"), __LINE__);
+
+    value = JSON::Parse(stream, content, StringUtils::Count(content), exact_first);
+    stream.Clear();
+    test.IsEqual(value.Stringify(stream), R"({"items":[{"id":1,"price":10},{"price":20}]})", __LINE__);
+    stream.Clear();
+
+    JSONPaths<char> any_first;
+    test.IsTrue(any_first.Add("items[*].price"), __LINE__);
+    test.IsTrue(any_first.Add("items[0].id"), __LINE__);
+
+    value = JSON::Parse(stream, content, StringUtils::Count(content), any_first);
+    stream.Clear();
+    test.IsEqual(value.Stringify(stream), R"({"items":[{"id":1,"price":10},{"price":20}]})", __LINE__);
+    stream.Clear();
+
+    JSONPaths<char> any_whole;
+    test.IsTrue(any_whole.Add("items[1].id"), __LINE__);
+    test.IsTrue(any_whole.Add("items[*]"), __LINE__);
+
+    value = JSON::Parse(stream, content, StringUtils::Count(content), any_whole);
+    stream.Clear();
+    test.IsEqual(value.Stringify(stream), R"({"items":[{"id":1,"price":10,"x":0},{"id":2,"price":20}]})", __LINE__);
+}
+
+struct JSONTestLineCollector {
+    void operator()(Value<char> &value, SizeT offset) {
+        if (Output.IsNotEmpty()) {
+            Output += "|";
+        }
+
+        Digit::NumberToString(Output, offset);
+        Output += ":";
+
+        if (value.IsUndefined()) {
+            Output += "X";
+        } else {
+            value.Stringify(Output);
+        }
+    }
+
+    StringStream<char> Output;
+};
+
+struct JSONTestLineCounter {
+    void operator()(const char *, SizeT length, SizeT) {
+        Total += length;
+        ++Lines;
+    }
+
+    SizeT Total{0};
+    SizeT Lines{0};
+};
+
+static void TestParseLines(QTest &test) {
+    JSONTestLineCollector collector;
+    const char           *content;
+
+    content = "{\"a\":1}\n[1,\"x\"]\r\n\n   \n{\"b\":tru}\n{\"c\":\"\\n\"}";
+    test.IsEqual(JSON::ParseLines(content, StringUtils::Count(content), collector), SizeT{4}, __LINE__);
+    test.IsEqual(collector.Output, R"(0:{"a":1}|8:[1,"x"]|22:X|32:{"c":"\n"})", __LINE__);
+
+    JSONTestLineCollector collector2;
+    test.IsEqual(JSON::ParseLines("", 0, collector2), SizeT{0}, __LINE__);
+    test.IsEqual(JSON::ParseLines("\n\n", 2, collector2), SizeT{0}, __LINE__);
+
+    // Long lines cross the SIMD blocks.
+    StringStream<char> lines;
+    SizeT              i = 0;
+
+    while (i < 100) {
+        lines += R"({"id":)";
+        Digit::NumberToString(lines, i);
+        lines += R"(,"text":"abcdefghijklmnopqrstuvwxyz0123456789abcdefghijklmnopqrstuvwxyz"})";
+        lines += "\n";
+        ++i;
+    }
+
+    JSONTestLineCounter counter;
+    test.IsEqual(JSON::ForEachLine(lines.First(), lines.Length(), counter), SizeT{100}, __LINE__);
+    test.IsEqual(counter.Total + 100, lines.Length(), __LINE__);
+
+    // Split for workers: every range ends at a line break and together they cover everything.
+    Array<StringView<char>> ranges;
+    JSON::SplitLines(lines.First(), lines.Length(), 7, ranges);
+    test.IsEqual(ranges.Size(), SizeT{7}, __LINE__);
+
+    SizeT covered = 0;
+    SizeT records = 0;
+
+    for (const StringView<char> &range : ranges) {
+        test.IsTrue(range.First() == (lines.First() + covered), __LINE__);
+        test.IsEqual(range.First()[range.Length() - 1], '\n', __LINE__);
+        covered += range.Length();
+
+        JSONTestLineCounter range_counter;
+        records += JSON::ForEachLine(range.First(), range.Length(), range_counter);
+    }
+
+    test.IsEqual(covered, lines.Length(), __LINE__);
+    test.IsEqual(records, SizeT{100}, __LINE__);
+
+    ranges.Clear();
+    JSON::SplitLines("{}", 2, 4, ranges);
+    test.IsEqual(ranges.Size(), SizeT{1}, __LINE__);
+    test.IsEqual(ranges.First()->Length(), SizeT{2}, __LINE__);
+}
+
+static void TestParseFile(QTest &test) {
+#if defined(__linux__)
+    const char *path    = "/tmp/QentemJSONParseFileTest.json";
+    const char *content = R"({"name": "Qentem", "esc": "a\"b", "list": [1, 2.5, true, null]})";
+    const int   fd      = static_cast<int>(SystemCall(__NR_openat, Q_AT_FDCWD, reinterpret_cast<SystemLongI>(path),
+                                                      (Q_WRONLY | Q_CREAT | Q_TRUNC), 0600));
+
+    test.IsTrue(fd >= 0, __LINE__);
+    SystemCall(__NR_write, fd, reinterpret_cast<SystemLongI>(content), StringUtils::Count(content));
+    SystemCall(__NR_close, fd);
+
+    StringStream<char> stream;
+    Value<char>        value;
+
+    {
+        FileMap file;
+        value = JSON::ParseFile(path, file);
+        test.IsTrue(value.IsObject(), __LINE__);
+        test.IsEqual(file.Length(), SystemLong(StringUtils::Count(content)), __LINE__);
+        test.IsTrue(value["name"].GetString()->IsBorrowed(), __LINE__);
+        test.IsEqual(value.Stringify(stream), R"({"name":"Qentem","esc":"a\"b","list":[1,2.5,true,null]})", __LINE__);
+        value.Reset();
+    }
+
+    value = JSON::ParseFile(path);
+    test.IsTrue(value.IsObject(), __LINE__);
+    test.IsFalse(value["name"].GetString()->IsBorrowed(), __LINE__);
+
+    SystemCall(__NR_unlinkat, Q_AT_FDCWD, reinterpret_cast<SystemLongI>(path), 0);
+
+    value = JSON::ParseFile(path);
+    test.IsTrue(value.IsUndefined(), __LINE__);
+
+    FileMap missing;
+    test.IsFalse(missing.Open(path), __LINE__);
+    test.IsTrue(missing.IsEmpty(), __LINE__);
+#else
+    (void)test;
+#endif
+}
+
 template <typename String_T>
 static void TestParseWithComments(QTest &test) {
     Value<char>        value;
@@ -2241,6 +3303,16 @@ static int RunJSONTests() {
     test.Test("Parse Test 7", TestParse7);
     test.Test("Parse Test 8", TestParse8);
     test.Test("Parse Test 9", TestParse9);
+    test.Test("Parse Test 10", TestParse10);
+    test.Test("JSONIndex Test", TestJSONIndex);
+    test.Test("ParseBorrowed Test", TestParseBorrowed);
+    test.Test("ParseInterned Test", TestParseInterned);
+    test.Test("JSONPushParser Test", TestPushParser);
+    test.Test("JSONPushParser Fuzz Test", TestPushParserFuzz);
+    test.Test("Walk Test", TestWalk);
+    test.Test("Parse with JSONPaths Test", TestParsePaths);
+    test.Test("ParseLines Test", TestParseLines);
+    test.Test("ParseFile Test", TestParseFile);
     test.Test("ParseWithComments Test 1", TestParseWithComments<StringStream<char>>);
     test.Test("ParseWithComments Test 2", TestParseWithComments<String<char>>);
 
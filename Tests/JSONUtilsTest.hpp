@@ -337,6 +337,27 @@ static void TestEscapeJSON(QTest &test) {
     Escape(str, buffer);
     test.IsEqual(buffer, R"(\t\r\n\f\b\/\\\")", __LINE__);
     buffer.Clear();
+
+    // Longer than a SIMD block, with escapes on both sides of the block edges.
+    str = "0123456789abcdefghijklmnopqrstu\"0123456789abcdefghijklmnopqrstuvwxyz\n0123456789abcdefghijklmno\\";
+    Escape(str, buffer);
+    test.IsEqual(buffer,
+                 R"(0123456789abcdefghijklmnopqrstu\"0123456789abcdefghijklmnopqrstuvwxyz\n0123456789abcdefghijklmno\\)",
+                 __LINE__);
+    test.IsEqual(JSONUtils::EscapedLength(str, StringUtils::Count(str)), buffer.Length(), __LINE__);
+    buffer.Clear();
+
+    str = "0123456789abcdefghijklmnopqrstuvwxyz0123456789abcdefghijklmnopqrstuvwxyz";
+    Escape(str, buffer);
+    test.IsEqual(buffer, str, __LINE__);
+    test.IsEqual(JSONUtils::EscapedLength(str, StringUtils::Count(str)), buffer.Length(), __LINE__);
+    buffer.Clear();
+
+    str = "\"\\/\b\f\n\r\t\"\\/\b\f\n\r\t\"\\/\b\f\n\r\t\"\\/\b\f\n\r\t\"\\/\b\f\n\r\t";
+    Escape(str, buffer);
+    test.IsEqual(JSONUtils::EscapedLength(str, StringUtils::Count(str)), SizeT{80}, __LINE__);
+    test.IsEqual(buffer.Length(), SizeT{80}, __LINE__);
+    buffer.Clear();
 }
 
 static void TestUnEscapeJSON1(QTest &test) {
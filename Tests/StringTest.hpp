@@ -372,11 +372,10 @@ static void TestString2(QTest &test) {
         const SizeT32 max = 8;
         SizeT32       index{0};
 
-        void operator<<(const char *c) noexcept {
-            while (index < max) {
-                str[index] = *c;
+        void operator<<(char c) noexcept {
+            if (index < max) {
+                str[index] = c;
                 ++index;
-                ++c;
             }
         }
     };
@@ -610,6 +609,184 @@ static void TestStringTrim(QTest &test) {
     test.IsEqual(str1.Length(), SizeT{4U}, __LINE__);
 }
 
+static void TestStringBorrow(QTest &test) {
+    const char *content = "abcdefgh";
+    QString     str1;
+    QString     str2;
+
+    str1.Borrow(content, 3);
+    test.IsTrue(str1.IsBorrowed(), __LINE__);
+    test.IsEqual(str1.First(), content, __LINE__);
+    test.IsEqual(str1.Length(), SizeT{3U}, __LINE__);
+    test.IsTrue(str1 == "abc", __LINE__);
+
+    str2 = str1;
+    test.IsFalse(str2.IsBorrowed(), __LINE__);
+    test.IsTrue(str2 == "abc", __LINE__);
+    test.IsEqual(str2.First()[3], char{0}, __LINE__);
+
+    str2 = QUtility::Move(str1);
+    test.IsTrue(str2.IsBorrowed(), __LINE__);
+    test.IsFalse(str1.IsBorrowed(), __LINE__);
+    test.IsEqual(str2.First(), content, __LINE__);
+
+    str2 += "xy";
+    test.IsFalse(str2.IsBorrowed(), __LINE__);
+    test.IsTrue(str2 == "abcxy", __LINE__);
+    test.IsTrue(StringUtils::IsEqual(content, "abcdefgh", 8), __LINE__);
+
+    str1.Borrow(content, 4);
+    str1 += 'z';
+    test.IsTrue(str1 == "abcdz", __LINE__);
+
+    str1.Borrow(content, 4);
+    str1.StepBack(1);
+    test.IsFalse(str1.IsBorrowed(), __LINE__);
+    test.IsTrue(str1 == "abc", __LINE__);
+
+    str1.Borrow(content, 4);
+    str1.Reverse();
+    test.IsTrue(str1 == "dcba", __LINE__);
+
+    // Writable pointers are handed out only after the text is copied; content is read-only.
+    str1.Borrow(content, 4);
+
+    for (char &ch : str1) {
+        ch = 'X';
+    }
+
+    test.IsFalse(str1.IsBorrowed(), __LINE__);
+    test.IsTrue(str1 == "XXXX", __LINE__);
+    test.IsTrue(StringUtils::IsEqual(content, "abcdefgh", 8), __LINE__);
+
+    str1.Borrow(content, 4);
+    *(str1.Last()) = 'z';
+    test.IsTrue(str1 == "abcz", __LINE__);
+
+    str1.Borrow(content, 4);
+    str1.Storage()[0] = 'z';
+    test.IsTrue(str1 == "zbcd", __LINE__);
+    test.IsEqual(str1.First()[4], char{0}, __LINE__);
+    test.IsTrue(StringUtils::IsEqual(content, "abcdefgh", 8), __LINE__);
+
+    str1.Borrow(content, 8);
+    str1.SetLength(2);
+    test.IsTrue(str1 == "ab", __LINE__);
+    test.IsTrue(StringUtils::IsEqual(content, "abcdefgh", 8), __LINE__);
+
+    str1.Borrow(content, 2);
+    char *detached = str1.Detach();
+    test.IsFalse(detached == content, __LINE__);
+    test.IsTrue(StringUtils::IsEqual(detached, "ab", 3), __LINE__);
+    Reserver::Release(detached, 3);
+
+    str1.Borrow(content, 5);
+    str1.Reset();
+    test.IsEqual(str1.Length(), SizeT{0U}, __LINE__);
+    test.IsFalse(str1.IsBorrowed(), __LINE__);
+
+    // Written to a stream, a borrowed string ends at its length; it has no null to end at.
+    struct CharStream {
+        QString Text;
+
+        CharStream &operator<<(char ch) {
+            Text += ch;
+            return *this;
+        }
+    };
+
+    CharStream stream;
+
+    str1.Borrow(content, 3);
+    stream << str1;
+    test.IsTrue(stream.Text == "abc", __LINE__);
+}
+
+static void TestStringInline(QTest &test) {
+    constexpr SizeT inline_capacity = QString::InlineCapacity;
+    const char     *content         = "abcdefghijklmnopqrstuvwxyz0123456789";
+
+    test.IsTrue(inline_capacity >= SizeT{7}, __LINE__);
+    test.IsEqual(sizeof(QString), (sizeof(char *) + (sizeof(SizeT) * 2U)), __LINE__);
+
+    QString str1{content, inline_capacity};
+    test.IsTrue(str1.IsInline(), __LINE__);
+    test.IsEqual(str1.Length(), inline_capacity, __LINE__);
+    test.IsEqual(str1.Capacity(), inline_capacity, __LINE__);
+    test.IsEqual(str1.First()[inline_capacity], char{0}, __LINE__);
+    test.IsTrue(str1.IsEqual(content, inline_capacity), __LINE__);
+
+    QString str2{QUtility::Move(str1)};
+    test.IsTrue(str2.IsInline(), __LINE__);
+    test.IsTrue(str2.IsEqual(content, inline_capacity), __LINE__);
+    test.IsFalse(str1.IsInline(), __LINE__);
+    test.IsNull(str1.First(), __LINE__);
+    test.IsEqual(str1.Length(), SizeT{0}, __LINE__);
+
+    str1 = str2;
+    test.IsTrue(str1.IsInline(), __LINE__);
+    test.IsNotEqual(str1.First(), str2.First(), __LINE__);
+    test.IsEqual(str1, str2, __LINE__);
+
+    // Growing past the inline storage moves the text to the heap.
+    str1 += 'z';
+    test.IsFalse(str1.IsInline(), __LINE__);
+    test.IsEqual(str1.Length(), (inline_capacity + SizeT{1}), __LINE__);
+    test.IsTrue(str1.Capacity() > inline_capacity, __LINE__);
+    test.IsTrue(StringUtils::IsEqual(str1.First(), content, inline_capacity), __LINE__);
+    test.IsEqual(str1.First()[inline_capacity], 'z', __LINE__);
+
+    str2.StepBack(2);
+    test.IsTrue(str2.IsInline(), __LINE__);
+    test.IsTrue(str2.IsEqual(content, (inline_capacity - SizeT{2})), __LINE__);
+    test.IsEqual(str2.First()[str2.Length()], char{0}, __LINE__);
+
+    str2.Clear();
+    test.IsTrue(str2.IsInline(), __LINE__);
+    test.IsEqual(str2.Length(), SizeT{0}, __LINE__);
+    str2 += "ab";
+    test.IsEqual(str2, "ab", __LINE__);
+
+    QString str3{SizeT{3}};
+    test.IsTrue(str3.IsInline(), __LINE__);
+    test.IsEqual(str3.Length(), SizeT{0}, __LINE__);
+    str3.Write(content, 36U);
+    test.IsFalse(str3.IsInline(), __LINE__);
+    test.IsTrue(str3.IsEqual(content, 36U), __LINE__);
+
+    str3 = "xyz";
+    test.IsFalse(str3.IsInline(), __LINE__); // Keeps its reservation.
+    test.IsEqual(str3, "xyz", __LINE__);
+
+    str2 = QString::Merge(QString{"ab"}, QString{"cd"});
+    test.IsTrue(str2.IsInline(), __LINE__);
+    test.IsEqual(str2, "abcd", __LINE__);
+
+    str2.Borrow(content, 26U);
+    str2.SetLength(3U);
+    test.IsTrue(str2.IsInline(), __LINE__);
+    test.IsEqual(str2, "abc", __LINE__);
+
+    str2 = "abc";
+    const SizeT capacity = str2.Capacity();
+    char       *detached = str2.Detach();
+    test.IsFalse(str2.IsInline(), __LINE__);
+    test.IsNull(str2.First(), __LINE__);
+    test.IsTrue(StringUtils::IsEqual(detached, "abc", 4U), __LINE__);
+
+    str2.Adopt(detached, 3U, capacity);
+    test.IsFalse(str2.IsInline(), __LINE__);
+    test.IsEqual(str2.First(), detached, __LINE__);
+    test.IsEqual(str2, "abc", __LINE__);
+
+    String<char32_t> str4{U"ab"};
+    test.IsTrue(str4.IsInline(), __LINE__);
+    test.IsEqual(str4.Length(), SizeT{2}, __LINE__);
+    str4 += U"cdefgh";
+    test.IsFalse(str4.IsInline(), __LINE__);
+    test.IsTrue(str4 == U"abcdefgh", __LINE__);
+}
+
 static int RunStringTests() {
     QTest test{"String.hpp", __FILE__};
 
@@ -620,6 +797,8 @@ static int RunStringTests() {
     test.Test("String Test 2", TestString2);
     test.Test("String Test 2", TestString3);
     test.Test("String::Trim", TestStringTrim);
+    test.Test("String::Borrow", TestStringBorrow);
+    test.Test("String::Inline", TestStringInline);
 
     return test.EndTests();
 }
@@ -0,0 +1,22 @@
+/*
+ * Renders per second for each shape in TemplateFuzzTest.hpp (FuzzShapes order), used by the
+ * throughput gate (-D QENTEM_THROUGHPUT_GATE=1). The gate fails on a zero entry.
+ *
+ * Measured on one x86-64 Linux machine, GCC, in an -O0 build with the default CMake flags
+ * (SSE2); each entry is the slowest of six recorded runs. These numbers only hold there: with
+ * ENABLE_THROUGHPUT_GATE, record a baseline for the gating machine and build type first
+ * (-D QENTEM_THROUGHPUT_RECORD=1) and paste the printed array.
+ */
+
+#ifndef QENTEM_TEMPLATE_FUZZ_BASELINE_H
+#define QENTEM_TEMPLATE_FUZZ_BASELINE_H
+
+namespace Qentem {
+namespace Test {
+
+static constexpr SizeT64 TemplateFuzzBaseline[] = {398836ULL, 327946ULL, 125804ULL, 82979ULL, 153348ULL};
+
+} // namespace Test
+} // namespace Qentem
+
+#endif
@@ -0,0 +1,9 @@
+#include "TemplateFuzzTest.hpp"
+
+int main() {
+    Qentem::QTest::PrintInfo();
+    const int ret = Qentem::Test::RunTemplateFuzzTests();
+    Qentem::QTest::PrintMemoryStatus();
+
+    return ret;
+}
@@ -0,0 +1,769 @@
+/*
+ * Copyright (c) 2026 Hani Ammar
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef QENTEM_TEMPLATE_FUZZ_TESTS_H
+#define QENTEM_TEMPLATE_FUZZ_TESTS_H
+
+#include "Qentem/QTest.hpp"
+#include "Qentem/StringStream.hpp"
+#include "Qentem/Value.hpp"
+#include "Qentem/Template.hpp"
+
+#if defined(__linux__)
+#include "Qentem/SystemCall.hpp"
+#endif
+
+#include "TemplateFuzzBaseline.hpp"
+
+/*
+ * Seeded templates and values are rendered by Template.hpp and by a slow reference
+ * interpreter that walks the generated tree; both outputs must match.
+ *
+ * Throughput gate (off by default; timings are machine dependent):
+ *   -D QENTEM_THROUGHPUT_GATE=1      Fail when renders/s drop more than QENTEM_THROUGHPUT_MAX_DROP
+ *                                    percent below TemplateFuzzBaseline.hpp.
+ *   -D QENTEM_THROUGHPUT_RECORD=1    Print a new TemplateFuzzBaseline.hpp for this machine.
+ */
+
+#ifndef QENTEM_THROUGHPUT_MAX_DROP
+#define QENTEM_THROUGHPUT_MAX_DROP 10
+#endif
+
+#ifndef QENTEM_FUZZ_SEEDS
+#define QENTEM_FUZZ_SEEDS 200
+#endif
+
+namespace Qentem {
+namespace Test {
+
+// Deterministic generator (SplitMix64); same seed, same template on every platform.
+struct FuzzRandom {
+    explicit FuzzRandom(SizeT64 seed) noexcept : state_{seed} {
+    }
+
+    SizeT64 Next() noexcept {
+        SizeT64 value = (state_ += 0x9E3779B97F4A7C15ULL);
+        value         = ((value ^ (value >> 30U)) * 0xBF58476D1CE4E5B9ULL);
+        value         = ((value ^ (value >> 27U)) * 0x94D049BB133111EBULL);
+        return (value ^ (value >> 31U));
+    }
+
+    SizeT32 Below(SizeT32 limit) noexcept {
+        return static_cast<SizeT32>(Next() % limit);
+    }
+
+  private:
+    SizeT64 state_;
+};
+
+enum struct FuzzNodeType : SizeT8 { Text, Variable, RawVariable, Missing, Math, InLineIf, SuperVariable, If, Loop };
+
+/*
+ * A variable reference: Scope 0 is the root object; Scope N is the value of the loop in slot N - 1.
+ * An empty Field refers to the loop value itself.
+ */
+struct FuzzVariable {
+    String<char> Field{};
+    SizeT        Scope{0};
+};
+
+struct FuzzNode {
+    Array<FuzzNode> Children{};
+    Array<FuzzNode> Else{};
+    String<char>    Text{};
+    FuzzVariable    Left{};
+    FuzzVariable    Right{};
+    FuzzNodeType    Type{FuzzNodeType::Text};
+    SizeT8          Operation{0};
+};
+
+// Generated shapes; each one stresses a different part of the renderer.
+struct FuzzShape {
+    const char *Name;
+    SizeT32     Kinds; // Bit mask of FuzzNodeType allowed.
+    SizeT32     MaxDepth;
+    SizeT32     Width;
+};
+
+static constexpr SizeT32 FuzzBit(FuzzNodeType type) noexcept {
+    return (1U << static_cast<SizeT32>(type));
+}
+
+static constexpr FuzzShape FuzzShapes[] = {
+    {"variables",
+     (FuzzBit(FuzzNodeType::Text) | FuzzBit(FuzzNodeType::Variable) | FuzzBit(FuzzNodeType::RawVariable) |
+      FuzzBit(FuzzNodeType::Missing)),
+     0U, 24U},
+    {"math", (FuzzBit(FuzzNodeType::Text) | FuzzBit(FuzzNodeType::Math) | FuzzBit(FuzzNodeType::InLineIf)), 0U, 16U},
+    {"loops",
+     (FuzzBit(FuzzNodeType::Text) | FuzzBit(FuzzNodeType::Variable) | FuzzBit(FuzzNodeType::Loop) |
+      FuzzBit(FuzzNodeType::Math)),
+     1U, 8U},
+    {"nested",
+     (FuzzBit(FuzzNodeType::Text) | FuzzBit(FuzzNodeType::Variable) | FuzzBit(FuzzNodeType::Loop) |
+      FuzzBit(FuzzNodeType::If)),
+     3U, 5U},
+    {"mixed",
+     (FuzzBit(FuzzNodeType::Text) | FuzzBit(FuzzNodeType::Variable) | FuzzBit(FuzzNodeType::RawVariable) |
+      FuzzBit(FuzzNodeType::Missing) | FuzzBit(FuzzNodeType::Math) | FuzzBit(FuzzNodeType::InLineIf) |
+      FuzzBit(FuzzNodeType::SuperVariable) | FuzzBit(FuzzNodeType::If) | FuzzBit(FuzzNodeType::Loop)),
+     2U, 6U},
+};
+
+static constexpr SizeT32 FuzzShapesCount = (sizeof(FuzzShapes) / sizeof(FuzzShape));
+
+struct FuzzNames {
+    static constexpr SizeT32 Strings  = 4U; // s0..s3
+    static constexpr SizeT32 Integers = 4U; // n0..n3
+    static constexpr SizeT32 Arrays   = 2U; // a0..a1 of {s, n, d, sub: [n...]}
+};
+
+static String<char> FuzzName(char prefix, SizeT32 index) {
+    const char name[2] = {prefix, static_cast<char>('0' + index)};
+    return String<char>{name, SizeT{2}};
+}
+
+static String<char> FuzzString(FuzzRandom &random, SizeT32 max_length) {
+    static constexpr char alphabet[] = "abcXYZ019 .,-_&<>\"'";
+
+    String<char> str;
+    SizeT32      length = random.Below(max_length + 1U);
+
+    while (length != 0) {
+        str += alphabet[random.Below(sizeof(alphabet) - 1U)];
+        --length;
+    }
+
+    return str;
+}
+
+static SizeT64I FuzzInteger(FuzzRandom &random) {
+    return (static_cast<SizeT64I>(random.Below(101U)) - 50);
+}
+
+static void GenerateFuzzValue(FuzzRandom &random, Value<char> &value) {
+    SizeT32 index = 0;
+
+    value.Reset();
+
+    while (index < FuzzNames::Strings) {
+        value[FuzzName('s', index)] = FuzzString(random, 12U);
+        value[FuzzName('n', index)] = FuzzInteger(random);
+        ++index;
+    }
+
+    value["d0"]  = (static_cast<double>(FuzzInteger(random)) / 4.0);
+    value["b0"]  = (random.Below(2U) == 0U);
+    value["fmt"] = "<{0}|{1}>{0}&";
+
+    index = 0;
+
+    while (index < FuzzNames::Arrays) {
+        Value<char> &array = value[FuzzName('a', index)];
+        SizeT32      count = (random.Below(4U) + 1U);
+
+        while (count != 0) {
+            Value<char> item;
+            SizeT32     sub_count = (random.Below(3U) + 1U);
+
+            item["s"] = FuzzString(random, 6U);
+            item["n"] = FuzzInteger(random);
+            item["d"] = (static_cast<double>(FuzzInteger(random)) / 8.0);
+
+            Value<char> &sub = item["sub"];
+
+            while (sub_count != 0) {
+                sub += FuzzInteger(random);
+                --sub_count;
+            }
+
+            array += QUtility::Move(item);
+            --count;
+        }
+
+        ++index;
+    }
+}
+
+/*
+ * Picks a variable visible at the given depth. Every nesting level (loop or if) takes one slot so
+ * loop value names stay unique (`l0`, `l1`, ...); slot_kinds[d] is 0 when slot d loops over records
+ * ({s, n, d, sub}), 1 when it loops over the integers of a `sub` array, and 2 for an if block.
+ */
+static FuzzVariable FuzzPickVariable(FuzzRandom &random, const SizeT8 *slot_kinds, SizeT32 depth, bool integer) {
+    FuzzVariable var;
+    SizeT32      loops[8];
+    SizeT32      loops_count = 0;
+    SizeT32      slot        = 0;
+
+    while (slot < depth) {
+        if (slot_kinds[slot] != 2U) {
+            loops[loops_count] = slot;
+            ++loops_count;
+        }
+
+        ++slot;
+    }
+
+    if ((loops_count != 0) && (random.Below(2U) == 0U)) {
+        slot      = loops[random.Below(loops_count)];
+        var.Scope = (slot + 1U);
+
+        if (slot_kinds[slot] == 1U) {
+            return var; // Loop value is an integer.
+        }
+
+        if (integer) {
+            var.Field = "n";
+        } else {
+            static constexpr const char *fields[] = {"s", "n", "d"};
+            var.Field                             = fields[random.Below(3U)];
+        }
+
+        return var;
+    }
+
+    if (integer) {
+        var.Field = FuzzName('n', random.Below(FuzzNames::Integers));
+    } else {
+        switch (random.Below(4U)) {
+            case 0U: {
+                var.Field = "d0";
+                break;
+            }
+
+            case 1U: {
+                var.Field = "b0";
+                break;
+            }
+
+            case 2U: {
+                var.Field = FuzzName('n', random.Below(FuzzNames::Integers));
+                break;
+            }
+
+            default: {
+                var.Field = FuzzName('s', random.Below(FuzzNames::Strings));
+            }
+        }
+    }
+
+    return var;
+}
+
+static void GenerateFuzzNodes(FuzzRandom &random, const FuzzShape &shape, Array<FuzzNode> &nodes, SizeT8 *slot_kinds,
+                              SizeT32 depth) {
+    static constexpr char text_alphabet[] = "abc XYZ.,-_019\n";
+
+    SizeT32 count = (random.Below(shape.Width) + 1U);
+
+    while (count != 0) {
+        FuzzNode     &node = nodes.Insert(FuzzNode{});
+        FuzzNodeType  type;
+        const SizeT32 types = (static_cast<SizeT32>(FuzzNodeType::Loop) + 1U);
+
+        do {
+            type = static_cast<FuzzNodeType>(random.Below(types));
+        } while (((shape.Kinds & FuzzBit(type)) == 0U) ||
+                 (((type == FuzzNodeType::If) || (type == FuzzNodeType::Loop)) && (depth >= shape.MaxDepth)));
+
+        node.Type = type;
+
+        switch (type) {
+            case FuzzNodeType::Text: {
+                SizeT32 length = (random.Below(8U) + 1U);
+
+                while (length != 0) {
+                    node.Text += text_alphabet[random.Below(sizeof(text_alphabet) - 1U)];
+                    --length;
+                }
+
+                break;
+            }
+
+            case FuzzNodeType::Variable:
+            case FuzzNodeType::RawVariable: {
+                node.Left = FuzzPickVariable(random, slot_kinds, depth, false);
+                break;
+            }
+
+            case FuzzNodeType::Missing: {
+                node.Left.Field = "missing";
+                break;
+            }
+
+            case FuzzNodeType::Math:
+            case FuzzNodeType::InLineIf:
+            case FuzzNodeType::If: {
+                node.Left      = FuzzPickVariable(random, slot_kinds, depth, true);
+                node.Right     = FuzzPickVariable(random, slot_kinds, depth, true);
+                node.Operation = static_cast<SizeT8>(random.Below((type == FuzzNodeType::Math) ? 3U : 6U));
+
+                if (type == FuzzNodeType::If) {
+                    slot_kinds[depth] = 2U;
+                    GenerateFuzzNodes(random, shape, node.Children, slot_kinds, (depth + 1U));
+
+                    if (random.Below(2U) == 0U) {
+                        GenerateFuzzNodes(random, shape, node.Else, slot_kinds, (depth + 1U));
+                    }
+                }
+
+                break;
+            }
+
+            case FuzzNodeType::SuperVariable: {
+                node.Left  = FuzzPickVariable(random, slot_kinds, depth, false);
+                node.Right = FuzzPickVariable(random, slot_kinds, depth, false);
+                break;
+            }
+
+            case FuzzNodeType::Loop: {
+                SizeT32 record_slot = depth;
+
+                // Nearest enclosing loop over records, if any.
+                while ((record_slot != 0) && (slot_kinds[record_slot - 1U] != 0U)) {
+                    --record_slot;
+                }
+
+                if ((record_slot != 0) && (random.Below(2U) == 0U)) {
+                    node.Left.Scope   = record_slot;
+                    node.Left.Field   = "sub";
+                    slot_kinds[depth] = 1U;
+                } else {
+                    node.Left.Field   = FuzzName('a', random.Below(FuzzNames::Arrays));
+                    slot_kinds[depth] = 0U;
+                }
+
+                GenerateFuzzNodes(random, shape, node.Children, slot_kinds, (depth + 1U));
+                break;
+            }
+        }
+
+        --count;
+    }
+}
+
+static void FuzzPath(const FuzzVariable &var, String<char> &out) {
+    if (var.Scope != 0) {
+        out += FuzzName('l', static_cast<SizeT32>(var.Scope - 1U));
+
+        if (var.Field.IsNotEmpty()) {
+            out += '[';
+            out += var.Field;
+            out += ']';
+        }
+    } else {
+        out += var.Field;
+    }
+}
+
+static void FuzzCondition(const FuzzNode &node, String<char> &out) {
+    static constexpr const char *operations[] = {"+", "-", "*", "<", ">=", "=="};
+
+    out += "{var:";
+    FuzzPath(node.Left, out);
+    out += "} ";
+    out += operations[node.Operation];
+    out += " {var:";
+    FuzzPath(node.Right, out);
+    out += '}';
+}
+
+static void EmitFuzzTemplate(const Array<FuzzNode> &nodes, String<char> &out, SizeT32 depth) {
+    for (const FuzzNode &node : nodes) {
+        switch (node.Type) {
+            case FuzzNodeType::Text: {
+                out += node.Text;
+                break;
+            }
+
+            case FuzzNodeType::Variable:
+            case FuzzNodeType::Missing: {
+                out += "{var:";
+                FuzzPath(node.Left, out);
+                out += '}';
+                break;
+            }
+
+            case FuzzNodeType::RawVariable: {
+                out += "{raw:";
+                FuzzPath(node.Left, out);
+                out += '}';
+                break;
+            }
+
+            case FuzzNodeType::Math: {
+                out += "{math:";
+                FuzzCondition(node, out);
+                out += '}';
+                break;
+            }
+
+            case FuzzNodeType::InLineIf: {
+                out += "{if case=\"";
+                FuzzCondition(node, out);
+                out += "\" true=\"yes\" false=\"no\"}";
+                break;
+            }
+
+            case FuzzNodeType::SuperVariable: {
+                out += "{svar:fmt, {var:";
+                FuzzPath(node.Left, out);
+                out += "}, {raw:";
+                FuzzPath(node.Right, out);
+                out += "}}";
+                break;
+            }
+
+            case FuzzNodeType::If: {
+                out += "<if case=\"";
+                FuzzCondition(node, out);
+                out += "\">";
+                EmitFuzzTemplate(node.Children, out, (depth + 1U));
+
+                if (node.Else.IsNotEmpty()) {
+                    out += "<else />";
+                    EmitFuzzTemplate(node.Else, out, (depth + 1U));
+                }
+
+                out += "</if>";
+                break;
+            }
+
+            case FuzzNodeType::Loop: {
+                out += "<loop set=\"";
+                FuzzPath(node.Left, out);
+                out += "\" value=\"";
+                out += FuzzName('l', depth);
+                out += "\">";
+                EmitFuzzTemplate(node.Children, out, (depth + 1U));
+                out += "</loop>";
+                break;
+            }
+        }
+    }
+}
+
+// Reference interpreter ------------------------------------------------------------
+
+static const Value<char> *FuzzResolve(const FuzzVariable &var, const Value<char> &root, const Value<char> **scopes) {
+    const Value<char> *base = ((var.Scope == 0) ? &root : scopes[var.Scope - 1U]);
+
+    if (var.Field.IsEmpty()) {
+        return base;
+    }
+
+    return base->GetValue(var.Field.First(), var.Field.Length());
+}
+
+static SizeT64I FuzzInteger(const FuzzVariable &var, const Value<char> &root, const Value<char> **scopes) {
+    return FuzzResolve(var, root, scopes)->GetInt64();
+}
+
+static SizeT64I FuzzEvaluate(const FuzzNode &node, const Value<char> &root, const Value<char> **scopes) {
+    const SizeT64I left  = FuzzInteger(node.Left, root, scopes);
+    const SizeT64I right = FuzzInteger(node.Right, root, scopes);
+
+    switch (node.Operation) {
+        case 0U:
+            return (left + right);
+        case 1U:
+            return (left - right);
+        case 2U:
+            return (left * right);
+        case 3U:
+            return (left < right);
+        case 4U:
+            return (left >= right);
+        default:
+            return (left == right);
+    }
+}
+
+static void FuzzWriteVariable(const FuzzVariable &var, const Value<char> &root, const Value<char> **scopes,
+                              bool escape, StringStream<char> &out) {
+    const Value<char>          *value = FuzzResolve(var, root, scopes);
+    const Digit::RealFormatInfo format_info{QentemConfig::TemplatePrecision, QENTEM_TEMPLATE_DOUBLE_FORMAT};
+
+    if (escape) {
+        value->CopyValueTo(out, format_info, &(StringUtils::EscapeHTMLSpecialChars<StringStream<char>, char>));
+    } else {
+        value->CopyValueTo(out, format_info);
+    }
+}
+
+static void ReferenceRender(const Array<FuzzNode> &nodes, const Value<char> &root, const Value<char> **scopes,
+                            SizeT32 depth, StringStream<char> &out) {
+    for (const FuzzNode &node : nodes) {
+        switch (node.Type) {
+            case FuzzNodeType::Text: {
+                out << node.Text;
+                break;
+            }
+
+            case FuzzNodeType::Variable:
+            case FuzzNodeType::RawVariable: {
+                FuzzWriteVariable(node.Left, root, scopes, (node.Type == FuzzNodeType::Variable), out);
+                break;
+            }
+
+            case FuzzNodeType::Missing: {
+                out << "{var:missing}";
+                break;
+            }
+
+            case FuzzNodeType::Math: {
+                Digit::NumberToString(out, FuzzEvaluate(node, root, scopes));
+                break;
+            }
+
+            case FuzzNodeType::InLineIf: {
+                out << ((FuzzEvaluate(node, root, scopes) > 0) ? "yes" : "no"); // Conditions hold when > 0.
+                break;
+            }
+
+            case FuzzNodeType::SuperVariable: {
+                // "<{0}|{1}>{0}&" with escaped literals.
+                StringUtils::EscapeHTMLSpecialChars(out, "<", SizeT{1});
+                FuzzWriteVariable(node.Left, root, scopes, true, out);
+                out << '|';
+                FuzzWriteVariable(node.Right, root, scopes, false, out);
+                StringUtils::EscapeHTMLSpecialChars(out, ">", SizeT{1});
+                FuzzWriteVariable(node.Left, root, scopes, true, out);
+                StringUtils::EscapeHTMLSpecialChars(out, "&", SizeT{1});
+                break;
+            }
+
+            case FuzzNodeType::If: {
+                if (FuzzEvaluate(node, root, scopes) > 0) {
+                    ReferenceRender(node.Children, root, scopes, (depth + 1U), out);
+                } else {
+                    ReferenceRender(node.Else, root, scopes, (depth + 1U), out);
+                }
+
+                break;
+            }
+
+            case FuzzNodeType::Loop: {
+                const Value<char> *set   = FuzzResolve(node.Left, root, scopes);
+                const SizeT        size  = set->Size();
+                SizeT              index = 0;
+
+                while (index < size) {
+                    scopes[depth] = set->GetValueAt(index);
+                    ReferenceRender(node.Children, root, scopes, (depth + 1U), out);
+                    ++index;
+                }
+
+                break;
+            }
+        }
+    }
+}
+
+// Generates the template and value for one (shape, seed) pair.
+static void GenerateFuzzCase(const FuzzShape &shape, SizeT64 seed, String<char> &content, Value<char> &value,
+                             StringStream<char> &expected) {
+    FuzzRandom         random{seed};
+    Array<FuzzNode>    nodes;
+    SizeT8             slot_kinds[8]{};
+    const Value<char> *scopes[8]{};
+
+    GenerateFuzzValue(random, value);
+    GenerateFuzzNodes(random, shape, nodes, slot_kinds, 0U);
+
+    content.Clear();
+    expected.Clear();
+    EmitFuzzTemplate(nodes, content, 0U);
+    ReferenceRender(nodes, value, scopes, 0U, expected);
+}
+
+static void TestTemplateFuzz(QTest &test) {
+    String<char>       content;
+    Value<char>        value;
+    StringStream<char> expected;
+    StringStream<char> ss;
+    SizeT32            shape_index = 0;
+
+    while (shape_index < FuzzShapesCount) {
+        const FuzzShape &shape = FuzzShapes[shape_index];
+        SizeT64          seed  = 1;
+
+        while (seed <= QENTEM_FUZZ_SEEDS) {
+            GenerateFuzzCase(shape, ((SizeT64{shape_index} << 32U) | seed), content, value, expected);
+
+            ss.Clear();
+            Template::Render(content.First(), content.Length(), value, ss);
+
+            if (ss != expected) {
+                QConsole::Print("\nShape: ", shape.Name, ", seed: ", seed, "\nTemplate: ", content, "\n");
+            }
+
+            test.IsEqual(ss, expected, __LINE__);
+            ++seed;
+        }
+
+        ++shape_index;
+    }
+}
+
+// Throughput gate ------------------------------------------------------------------
+
+// Monotonic time in nanoseconds; 0 where no clock is available.
+static SizeT64 FuzzClock() noexcept {
+#if defined(__linux__)
+    struct {
+        SystemLongI Seconds;
+        SystemLongI Nanoseconds;
+    } time{};
+
+    SystemCall(__NR_clock_gettime, 1 /* CLOCK_MONOTONIC */, reinterpret_cast<SystemLongI>(&time));
+    return ((static_cast<SizeT64>(time.Seconds) * 1000000000ULL) + static_cast<SizeT64>(time.Nanoseconds));
+#elif defined(_WIN32)
+    LARGE_INTEGER counter;
+    LARGE_INTEGER frequency;
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+    return static_cast<SizeT64>((static_cast<double>(counter.QuadPart) * 1e9) /
+                                static_cast<double>(frequency.QuadPart));
+#else
+    return 0;
+#endif
+}
+
+// Renders per second over the first 16 seeds of a shape, with parsed tags cached like a server would.
+// The fastest of several passes is kept, so a busy moment on the machine does not read as a slowdown.
+static SizeT64 MeasureFuzzShape(SizeT32 shape_index) {
+    constexpr SizeT32 seeds      = 16U;
+    constexpr SizeT32 passes     = 5U;
+    constexpr SizeT32 iterations = 400U;
+
+    String<char>        content[seeds];
+    Value<char>         values[seeds];
+    Array<Tags::TagBit> tags[seeds];
+    StringStream<char>  expected;
+    StringStream<char>  ss;
+    SizeT32             index = 0;
+
+    while (index < seeds) {
+        GenerateFuzzCase(FuzzShapes[shape_index], ((SizeT64{shape_index} << 32U) | (index + 1U)), content[index],
+                         values[index], expected);
+        TemplateCore<char, Value<char>, StringStream<char>>::Parse(content[index].First(), content[index].Length(),
+                                                                   tags[index]);
+        ++index;
+    }
+
+    SizeT64 fastest = 0;
+    SizeT32 pass    = 0;
+
+    while (pass < passes) {
+        const SizeT64 start = FuzzClock();
+        SizeT32       round = 0;
+
+        while (round < iterations) {
+            index = 0;
+
+            while (index < seeds) {
+                ss.Clear();
+                Template::Render(content[index].First(), content[index].Length(), values[index], ss, tags[index]);
+                ++index;
+            }
+
+            ++round;
+        }
+
+        const SizeT64 elapsed = (FuzzClock() - start);
+
+        if ((fastest == 0) || (elapsed < fastest)) {
+            fastest = elapsed;
+        }
+
+        ++pass;
+    }
+
+    if (fastest == 0) {
+        return 0;
+    }
+
+    return ((SizeT64{seeds} * iterations * 1000000000ULL) / fastest);
+}
+
+QENTEM_MAYBE_UNUSED
+static void TestTemplateThroughput(QTest &test) {
+    SizeT64 rates[FuzzShapesCount];
+    SizeT32 index = 0;
+
+    while (index < FuzzShapesCount) {
+        rates[index] = MeasureFuzzShape(index);
+
+        const SizeT64 baseline = TemplateFuzzBaseline[index];
+        QConsole::Print("\n    ", FuzzShapes[index].Name, ": ", rates[index], " renders/s (baseline: ", baseline, ")");
+
+#if defined(QENTEM_THROUGHPUT_GATE) && (QENTEM_THROUGHPUT_GATE == 1)
+        // A gate without a baseline or a clock cannot fail, so it must not pass either.
+        test.IsTrue((baseline != 0), __LINE__);
+        test.IsTrue((rates[index] != 0), __LINE__);
+
+        const SizeT64 floor = ((baseline * (100U - QENTEM_THROUGHPUT_MAX_DROP)) / 100U);
+        test.IsTrue((rates[index] >= floor), __LINE__);
+#else
+        (void)test;
+#endif
+
+        ++index;
+    }
+
+    QConsole::Print("\n");
+
+#if defined(QENTEM_THROUGHPUT_RECORD) && (QENTEM_THROUGHPUT_RECORD == 1)
+    QConsole::Print("\n// TemplateFuzzBaseline.hpp\nstatic constexpr Qentem::SizeT64 TemplateFuzzBaseline[] = {");
+
+    index = 0;
+
+    while (index < FuzzShapesCount) {
+        QConsole::Print(((index == 0) ? "" : ", "), rates[index], "ULL");
+        ++index;
+    }
+
+    QConsole::Print("};\n");
+#endif
+}
+
+static int RunTemplateFuzzTests() {
+    QTest test{"Template.hpp (fuzz)", __FILE__};
+
+    test.PrintGroupName();
+
+    test.Test("Render Fuzz Test", TestTemplateFuzz);
+
+#if (defined(QENTEM_THROUGHPUT_GATE) && (QENTEM_THROUGHPUT_GATE == 1)) || \
+    (defined(QENTEM_THROUGHPUT_RECORD) && (QENTEM_THROUGHPUT_RECORD == 1))
+    test.Test("Render Throughput Test", TestTemplateThroughput);
+#endif
+
+    return test.EndTests();
+}
+
+} // namespace Test
+} // namespace Qentem
+
+#endif
@@ -27,6 +27,7 @@
 #include "Qentem/StringStream.hpp"
 #include "Qentem/JSON.hpp"
 #include "Qentem/Template.hpp"
+#include "Qentem/CompactValue.hpp"
 
 namespace Qentem {
 namespace Test {
@@ -2400,6 +2401,75 @@ static void TestSuperVariableTag2(QTest &test) {
     ss.Clear();
 }
 
+static StringStream<char> &RenderWithBundle(const char *content, const Value<char> &value,
+                                            const MessageBundle<char> &bundle, StringStream<char> &ss) {
+    TemplateCore<char, Value<char>, StringStream<char>> temp{content, StringUtils::Count(content)};
+    Array<Tags::TagBit>                                 tags;
+
+    temp.SetMessageBundle(&bundle);
+    temp.Parse(tags);
+    temp.Render(tags, value, ss);
+
+    return ss;
+}
+
+static void TestSuperVariableTag3(QTest &test) {
+    StringStream<char>  ss;
+    StringStream<char>  expected;
+    Value<char>         value;
+    MessageBundle<char> bundle;
+
+    value[R"(a)"] = R"(<a>)";
+    value[R"(b)"] = 5;
+    value[R"(z)"] = R"(from value {0})";
+
+    bundle.Add("x_y_z", 5, R"(1<{0}>2 {1}{0}-{9}-{a{0}-)", 25);
+    bundle.Add("one", 3, R"({0})", 3);
+    bundle.Add("none", 4, R"('plain')", 7);
+
+    test.IsEqual(bundle.Size(), 3U, __LINE__);
+
+    if (QentemConfig::AutoEscapeHTML) {
+        test.IsEqual(RenderWithBundle(R"({svar:x_y_z, {var:a}, {raw:b}})", value, bundle, ss),
+                     R"(1&lt;&lt;a&gt;&gt;2 5&lt;a&gt;-{9}-{a{0}-)", __LINE__);
+        ss.Clear();
+
+        test.IsEqual(RenderWithBundle(R"(-{svar:none, {var:b}}-)", value, bundle, ss), R"(-&apos;plain&apos;-)", __LINE__);
+        ss.Clear();
+    } else {
+        test.IsEqual(RenderWithBundle(R"({svar:x_y_z, {var:a}, {raw:b}})", value, bundle, ss),
+                     R"(1<<a>>2 5<a>-{9}-{a{0}-)", __LINE__);
+        ss.Clear();
+
+        test.IsEqual(RenderWithBundle(R"(-{svar:none, {var:b}}-)", value, bundle, ss), R"(-'plain'-)", __LINE__);
+        ss.Clear();
+    }
+
+    test.IsEqual(RenderWithBundle(R"({svar:one, {math:{var:b}*2}})", value, bundle, ss), R"(10)", __LINE__);
+    ss.Clear();
+
+    // Fewer arguments than the message refers to: same output as the uncompiled scan.
+    value[R"(x_y_z)"] = R"(1<{0}>2 {1}{0}-{9}-{a{0}-)";
+    Template::Render(R"({svar:x_y_z, {var:b}})", value, expected);
+    test.IsEqual(RenderWithBundle(R"({svar:x_y_z, {var:b}})", value, bundle, ss), expected, __LINE__);
+    ss.Clear();
+
+    // Ids missing from the bundle are taken from the value.
+    test.IsEqual(RenderWithBundle(R"({svar:z, {var:b}})", value, bundle, ss), R"(from value 5)", __LINE__);
+    ss.Clear();
+
+    value.Reset();
+    value[R"(one)"] = R"(o:{0})";
+    value[R"(two)"] = R"(t:{0}{1})";
+    bundle.Reset();
+    bundle.Load(value);
+
+    test.IsEqual(bundle.Size(), 2U, __LINE__);
+    test.IsEqual(RenderWithBundle(R"({svar:one, {var:one}}|{svar:two, {var:two}, {var:one}})", value, bundle, ss),
+                 R"(o:o:{0}|t:t:{0}{1}o:{0})", __LINE__);
+    ss.Clear();
+}
+
 static void TestInlineIfTag(QTest &test) {
     using ArrayT = typename Value<char>::ArrayT;
 
@@ -3300,6 +3370,58 @@ static void TestLoopTag3(QTest &test) {
 
     test.IsEqual(Template::Render(content, value, ss), R"(7654321)", __LINE__);
     ss.Clear();
+
+    value = JSON::Parse(R"({"a0": [{"n": 5}, {"n": 6}], "a1": [1]})");
+
+    content = R"(<if case="1"><loop set="a0" value="l1"><loop set="a1" value="l2">x</loop>{var:l1[n]}</loop></if>)";
+    test.IsEqual(Template::Render(content, value, ss), R"(x5x6)", __LINE__);
+    ss.Clear();
+
+    content = R"(<loop set="a0" value="l1"><if case="1"><loop set="a1" value="l2">{var:l2}</loop></if>{var:l1[n]}</loop>)";
+    test.IsEqual(Template::Render(content, value, ss), R"(1516)", __LINE__);
+    ss.Clear();
+}
+
+static void TestLoopTag4(QTest &test) {
+    using TemplateCoreT = TemplateCore<char, Value<char>, StringStream<char>>;
+
+    StringStream<char>  ss;
+    Array<Tags::TagBit> tags;
+    const char         *content;
+
+    Value<char> value = JSON::Parse(R"(
+{
+    "root": "R",
+    "rows": [
+        {"id": 1, "meta": {"k": "x"}, "cells": [{"v": "a"}, {"v": "b"}]},
+        {"id": 2, "meta": {"k": "y"}, "cells": [{"v": "c"}]}
+    ]
+})");
+
+    content = R"(<loop set="rows" value="r"><loop set="r[cells]" value="c">)"
+              R"({var:r[meta][k]}{var:c[v]}{var:root}{math:{var:r[id]}+1}</loop>;</loop>)";
+
+    test.IsEqual(Template::Render(content, value, ss), R"(xaR2xbR2;ycR3;)", __LINE__);
+    ss.Clear();
+
+    TemplateCoreT::Parse(content, StringUtils::Count(content), tags);
+    const Tags::LoopTag &outer = tags.First()->GetLoopTag();
+    const Tags::LoopTag &inner = outer.SubTags.First()->GetLoopTag();
+    test.IsEqual(outer.HoistedCount, 1U, __LINE__); // root
+    test.IsEqual(inner.HoistedCount, 2U, __LINE__); // r[meta][k], r[id]
+    tags.Reset();
+
+    content = R"(<loop set="rows" value="r"><loop set="r[cells]" value="c">{var:r[id]}</loop>)"
+              R"(<loop set="r[cells]" value="c2">{var:r[meta][k]}</loop></loop>)";
+
+    test.IsEqual(Template::Render(content, value, ss), R"(11xx2y)", __LINE__);
+    ss.Clear();
+
+    content = R"(<loop set="rows" value="r"><loop set="r[cells]" value="c">)"
+              R"({if case="{var:r[id]} == 2" true="{var:r[meta][k]}" false="-"}</loop></loop>)";
+
+    test.IsEqual(Template::Render(content, value, ss), R"(--y)", __LINE__);
+    ss.Clear();
 }
 
 static void TestIfTag1(QTest &test) {
@@ -3742,6 +3864,42 @@ static void TestRender2(QTest &test) {
     ss.Clear();
 }
 
+static void TestRender3(QTest &test) {
+    StringStream<char> ss;
+    const char        *content;
+
+    // A frozen value renders like the one it came from.
+    const Value<char> value = JSON::Parse(
+        R"({"name":"A longer name","n":4,"ok":true,"list":[1,2.5,"x",null],)"
+        R"("big":{"a":1,"b":2,"c":3,"d":4,"e":5,"f":6,"g":7,"h":8,"i":9},)"
+        R"("rows":[{"id":1,"tag":"x"},{"id":2,"tag":"y"},{"id":3,"tag":"x"}]})");
+
+    const CompactTree<char> tree = value.Freeze();
+
+    content = R"({var:name} {var:n} {var:ok} {var:big[h]}{var:big[i]} {var:list[1]} {var:list[3]})";
+    test.IsEqual(Template::Render(content, tree.Root(), ss), R"(A longer name 4 true 89 2.5 null)", __LINE__);
+    ss.Clear();
+    test.IsEqual(Template::Render(content, value, ss), R"(A longer name 4 true 89 2.5 null)", __LINE__);
+    ss.Clear();
+
+    content = R"(<loop set="list" value="v">{var:v},</loop>)";
+    test.IsEqual(Template::Render(content, tree.Root(), ss), R"(1,2.5,x,null,)", __LINE__);
+    ss.Clear();
+
+    content = R"(<loop set="rows" value="r"><if case="{var:r[tag]} == x">{var:r[id]}</if></loop>)";
+    test.IsEqual(Template::Render(content, tree.Root(), ss), R"(13)", __LINE__);
+    ss.Clear();
+
+    content = R"({math:{var:big[a]}+{var:n}} {if case="{var:big[e]} > 4" true="yes" false="no"})";
+    test.IsEqual(Template::Render(content, tree.Root(), ss), R"(5 yes)", __LINE__);
+    ss.Clear();
+
+    // Grouping needs a Value.
+    content = R"(<loop set="rows" value="r" group="tag">{var:r}</loop>)";
+    test.IsEqual(Template::Render(content, tree.Root(), ss), R"()", __LINE__);
+    ss.Clear();
+}
+
 static int RunTemplateTests() {
     QTest test{"Template.hpp", __FILE__};
 
@@ -3762,18 +3920,21 @@ static int RunTemplateTests() {
 
     test.Test("Super Variable Tag Test 1", TestSuperVariableTag1);
     test.Test("Super Variable Tag Test 2", TestSuperVariableTag2);
+    test.Test("Super Variable Tag Test 3", TestSuperVariableTag3);
 
     test.Test("Inline if Tag Test", TestInlineIfTag);
 
     test.Test("Loop Tag Test 1", TestLoopTag1);
     test.Test("Loop Tag Test 2", TestLoopTag2);
     test.Test("Loop Tag Test 3", TestLoopTag3);
+    test.Test("Loop Tag Test 4", TestLoopTag4);
 
     test.Test("If Tag Test 1", TestIfTag1);
     test.Test("If Tag Test 2", TestIfTag2);
 
     test.Test("Render Test 1", TestRender1);
     test.Test("Render Test 2", TestRender2);
+    test.Test("Render Test 3", TestRender3);
 
     return test.EndTests();
 }
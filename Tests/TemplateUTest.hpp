@@ -3722,6 +3722,44 @@ static void TestRenderU2(QTest &test) {
     ss.Clear();
 }
 
+static void TestRenderU3(QTest &test) {
+    StringStream<char16_t> ss;
+    StringStream<char16_t> expected;
+    StringStream<char>     ss8;
+    UTF8Template           utf8_template;
+
+    const Value<char> value = JSON::Parse(
+        R"({"name": "\u00C9lise <3", "items": [{"price": 1.5}, {"price": 20}], "greet": "Hi {0}!"})");
+
+    const char16_t *content =
+        u"\u062D {var:name}: <loop set=\"items\" value=\"item\">[{var:item[price]}]</loop> {svar:greet, {var:name}} "
+        u"\U0001F600";
+
+    Template::ToUTF8(content, StringUtils::Count(content), utf8_template);
+    test.IsTrue(utf8_template.Tags.IsNotEmpty(), __LINE__);
+
+    if (QentemConfig::AutoEscapeHTML) {
+        test.IsEqual(Template::Render(utf8_template, value, ss),
+                     u"\u062D \u00C9lise &lt;3: [1.5][20] Hi \u00C9lise &lt;3! \U0001F600", __LINE__);
+    } else {
+        test.IsEqual(Template::Render(utf8_template, value, ss),
+                     u"\u062D \u00C9lise <3: [1.5][20] Hi \u00C9lise <3! \U0001F600", __LINE__);
+    }
+
+    // Same output as rendering the UTF-16 template directly.
+    const Value<char16_t> value16 = JSON::Parse(
+        uR"({"name": "\u00C9lise <3", "items": [{"price": 1.5}, {"price": 20}], "greet": "Hi {0}!"})");
+
+    Template::Render(content, value16, expected);
+    test.IsEqual(ss, expected, __LINE__);
+    ss.Clear();
+
+    // The cached tags can also be rendered straight to UTF-8.
+    Template::Render(utf8_template, value, ss8);
+    Unicode::FromUTF8<char16_t>(ss8.First(), ss8.Length(), ss);
+    test.IsEqual(ss, expected, __LINE__);
+}
+
 static int RunTemplateUTests() {
     QTest test{"Template.hpp (16-bit char)", __FILE__};
 
@@ -3754,6 +3792,7 @@ static int RunTemplateUTests() {
 
     test.Test("Render Test 1", TestRenderU1);
     test.Test("Render Test 2", TestRenderU2);
+    test.Test("Render Test 3", TestRenderU3);
 
     return test.EndTests();
 }
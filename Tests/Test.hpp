@@ -53,6 +53,7 @@ extern "C" int __cxa_thread_atexit(void (*f)(), void *o, void *d) {
 #include "TemplateTest.hpp"
 #include "TemplateLTest.hpp"
 #include "TemplateUTest.hpp"
+#include "TemplateFuzzTest.hpp"
 // clang-format on
 
 namespace Qentem {
@@ -141,6 +142,7 @@ static int RunTests() {
     ((Test::RunTemplateTests() == 0) ? ++passed : ++failed);
     ((Test::RunTemplateUTests() == 0) ? ++passed : ++failed);
     ((Test::RunTemplateLTests() == 0) ? ++passed : ++failed);
+    ((Test::RunTemplateFuzzTests() == 0) ? ++passed : ++failed);
 
     return PrintResult(passed, failed);
 }
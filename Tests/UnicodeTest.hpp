@@ -314,6 +314,48 @@ static void TestToUTF32(QTest &test) {
 //     }
 // }
 
+static void TestTranscodeUTF8(QTest &test) {
+    // "aé€😀b" as UTF-8 bytes.
+    const char utf8[] = "a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80\x62";
+
+    const char16_t utf16[] = {u'a', 0x00E9, 0x20AC, 0xD83D, 0xDE00, u'b'};
+    const char32_t utf32[] = {U'a', 0x00E9, 0x20AC, 0x1F600, U'b'};
+
+    StringStream<char>     stream8;
+    StringStream<char16_t> stream16;
+    StringStream<char32_t> stream32;
+
+    Unicode::ToUTF8(utf16, SizeT{6}, stream8);
+    test.IsEqual(stream8, utf8, __LINE__);
+    stream8.Clear();
+
+    Unicode::ToUTF8(utf32, SizeT{5}, stream8);
+    test.IsEqual(stream8, utf8, __LINE__);
+    stream8.Clear();
+
+    Unicode::FromUTF8<char16_t>(utf8, SizeT{11}, stream16);
+    test.IsTrue(stream16.IsEqual(utf16, SizeT{6}), __LINE__);
+
+    Unicode::FromUTF8<char32_t>(utf8, SizeT{11}, stream32);
+    test.IsTrue(stream32.IsEqual(utf32, SizeT{5}), __LINE__);
+
+    // Long ASCII runs go through the bulk buffer.
+    const char16_t *long_ascii = u"0123456789012345678901234567890123456789012345678901234567890123456789_end";
+    Unicode::ToUTF8(long_ascii, StringUtils::Count(long_ascii), stream8);
+    test.IsEqual(stream8, "0123456789012345678901234567890123456789012345678901234567890123456789_end", __LINE__);
+    stream8.Clear();
+
+    // Unpaired surrogates and malformed UTF-8 become U+FFFD.
+    const char16_t lone[] = {0xD83D, u'x', 0xDE00};
+    Unicode::ToUTF8(lone, SizeT{3}, stream8);
+    test.IsEqual(stream8, "\xEF\xBF\xBDx\xEF\xBF\xBD", __LINE__);
+    stream8.Clear();
+
+    stream16.Clear();
+    Unicode::FromUTF8<char16_t>("\xC3x\x80\xE2\x82", SizeT{5}, stream16);
+    test.IsEqual(stream16, u"\xFFFDx\xFFFD\xFFFD", __LINE__);
+}
+
 static int RunUnicodeTests() {
     // convertTo4Hex(0x10A7B);
     // convertTo4Hex(0x1F859);
@@ -326,6 +368,7 @@ static int RunUnicodeTests() {
     test.Test("ToUTF 8 Test", TestToUTF8);
     test.Test("ToUTF 16 Test", TestToUTF16);
     test.Test("ToUTF 32 Test", TestToUTF32);
+    test.Test("Transcode UTF-8 Test", TestTranscodeUTF8);
 
     return test.EndTests();
 }
@@ -25,6 +25,17 @@
 
 #include "Qentem/QTest.hpp"
 #include "Qentem/Value.hpp"
+#include "Qentem/MessagePack.hpp"
+#include "Qentem/CompactValue.hpp"
+#include "Qentem/JSONPatch.hpp"
+#include "Qentem/ValueBuilder.hpp"
+#include "Qentem/ColumnTable.hpp"
+#include "Qentem/JSON.hpp"
+
+#if defined(__linux__)
+// POSIX threads, for the shared value test.
+#include <pthread.h>
+#endif
 
 namespace Qentem {
 namespace Test {
@@ -3427,6 +3438,344 @@ static void TestCopyValue4(QTest &test) {
     ////////////////////////////////////////////
 }
 
+static void TestSharedValue(QTest &test) {
+    using ValueC = Value<char>;
+
+    StringStream<char> ss;
+    ValueC             value;
+    ValueC             copy1;
+    ValueC             copy2;
+    const ValueC      *item;
+
+    value["list"][0] = 1;
+    value["list"][1] = "a string that is not short";
+    value["name"]    = "name";
+
+    value.Share();
+    test.IsTrue(value.IsShared(), __LINE__);
+    test.IsTrue(value.IsObject(), __LINE__);
+    test.IsTrue(value.Type() == ValueType::ValuePtr, __LINE__);
+    test.IsTrue(value.TargetType() == ValueType::Object, __LINE__);
+
+    copy1 = value;
+    copy2 = copy1;
+    test.IsTrue(copy1.IsShared(), __LINE__);
+    test.IsTrue(copy2.IsShared(), __LINE__);
+    const ValueC &c_value = value;
+    const ValueC &c_copy1 = copy1;
+    const ValueC &c_copy2 = copy2;
+
+    // All read the same content.
+    test.IsEqual(c_copy2.GetObject(), c_value.GetObject(), __LINE__);
+    item                  = c_copy1.GetValue("list", 4);
+    test.IsNotNull(item, __LINE__);
+    test.IsEqual(item->GetValueAt(1)->GetStringView(), "a string that is not short", __LINE__);
+    test.IsTrue(copy1.IsShared(), __LINE__); // Reading through a const reference keeps sharing.
+
+    // Changing a copy gives it its own content.
+    copy1["name"] = "other";
+    test.IsFalse(copy1.IsShared(), __LINE__);
+    test.IsTrue(copy1.IsObject(), __LINE__);
+    test.IsEqual(copy1.Stringify(ss), R"({"list":[1,"a string that is not short"],"name":"other"})", __LINE__);
+    ss.Clear();
+    test.IsEqual(value.Stringify(ss), R"({"list":[1,"a string that is not short"],"name":"name"})", __LINE__);
+    ss.Clear();
+
+    // So does a non-const accessor.
+    test.IsNotNull(copy2.GetValue("list", 4), __LINE__);
+    test.IsFalse(copy2.IsShared(), __LINE__);
+    copy2.Remove("list", 4);
+    test.IsEqual(copy2.Stringify(ss), R"({"name":"name"})", __LINE__);
+    ss.Clear();
+
+    // The last reference takes the content over.
+    const ValueC::VItem *storage = c_value.GetObject()->First();
+    test.IsEqual(value.GetObject()->First(), storage, __LINE__);
+    test.IsFalse(value.IsShared(), __LINE__);
+    value["name"] = 1;
+    test.IsEqual(value.Stringify(ss), R"({"list":[1,"a string that is not short"],"name":1})", __LINE__);
+    ss.Clear();
+
+    // Shared values held inside containers.
+    value.Share();
+    copy1.Reset();
+    copy1 += value;
+    copy1 += value;
+    copy2 = copy1;
+    test.IsTrue(copy1.GetValueAt(0)->IsShared(), __LINE__);
+    test.IsTrue(copy2.GetValueAt(1)->IsShared(), __LINE__);
+    (*(copy2.GetValueAt(1)))["name"] = 2;
+    test.IsEqual(copy2.Stringify(ss),
+                 R"([{"list":[1,"a string that is not short"],"name":1},)"
+                 R"({"list":[1,"a string that is not short"],"name":2}])",
+                 __LINE__);
+    ss.Clear();
+
+    copy2 = QUtility::Move(copy1);
+    test.IsTrue(copy2.GetValueAt(0)->IsShared(), __LINE__);
+    test.IsFalse(copy1.IsShared(), __LINE__);
+
+    // Assigning replaces the reference.
+    copy1 = value;
+    copy1 = 5;
+    test.IsFalse(copy1.IsShared(), __LINE__);
+    copy1 = value;
+    copy1.Reset();
+    test.IsTrue(copy1.IsUndefined(), __LINE__);
+
+    // Pointers and scalars are not shared.
+    copy1.SetPointerToValue(&value);
+    copy1.Share();
+    test.IsFalse(copy1.IsShared(), __LINE__);
+    copy1 = 10;
+    copy1.Share();
+    test.IsFalse(copy1.IsShared(), __LINE__);
+
+    // Sorting a shared array sorts a copy.
+    copy1.Reset();
+    copy1 += 3;
+    copy1 += 1;
+    copy1 += 2;
+    copy1.Share();
+    copy2 = copy1;
+    copy2.Sort();
+    test.IsEqual(copy2.Stringify(ss), R"([1,2,3])", __LINE__);
+    ss.Clear();
+    test.IsEqual(copy1.Stringify(ss), R"([3,1,2])", __LINE__);
+    ss.Clear();
+}
+
+#if defined(__linux__)
+struct SharedValueWorker {
+    Value<char> Copy;
+    bool        Matched{false};
+};
+
+// Reads its copy, writes a changed one, then drops its reference while the sharing thread
+// still holds one.
+static void *SharedValueWork(void *arg) {
+    SharedValueWorker &worker = *static_cast<SharedValueWorker *>(arg);
+    const Value<char> &shared = worker.Copy;
+    Value<char>        changed{worker.Copy};
+    StringStream<char> ss;
+    bool               matched;
+
+    matched = (shared.Stringify(ss) == R"({"list":[1,"a string that is not short"],"name":"name"})");
+    ss.Clear();
+
+    changed["name"] = 2;
+    matched         = (matched && (changed.Stringify(ss) == R"({"list":[1,"a string that is not short"],"name":2})"));
+    matched         = (matched && shared.IsShared() && !(changed.IsShared()));
+
+    changed.Reset();
+    worker.Copy.Reset();
+    worker.Matched = matched;
+
+    return nullptr;
+}
+
+static void TestSharedValueThreads(QTest &test) {
+    constexpr SizeT32 count = 4U;
+
+    StringStream<char> ss;
+    Value<char>        value;
+    SharedValueWorker  workers[count];
+    pthread_t          threads[count];
+    SizeT32            index;
+
+    value["list"][0] = 1;
+    value["list"][1] = "a string that is not short";
+    value["name"]    = "name";
+    value.Share();
+
+    // The sharing thread keeps its reference and drops it last, after joining the others.
+    for (index = 0; index < count; index++) {
+        workers[index].Copy = value;
+        test.IsEqual(pthread_create(&(threads[index]), nullptr, SharedValueWork, &(workers[index])), 0, __LINE__);
+    }
+
+    for (index = 0; index < count; index++) {
+        test.IsEqual(pthread_join(threads[index], nullptr), 0, __LINE__);
+        test.IsTrue(workers[index].Matched, __LINE__);
+        test.IsFalse(workers[index].Copy.IsShared(), __LINE__);
+    }
+
+    test.IsTrue(value.IsShared(), __LINE__);
+    test.IsEqual(value.Stringify(ss), R"({"list":[1,"a string that is not short"],"name":"name"})", __LINE__);
+    value.Reset();
+}
+#endif
+
+static void TestValueHash(QTest &test) {
+    using ValueC = Value<char>;
+
+    ValueC value1;
+    ValueC value2;
+    ValueC copy;
+
+    value1 = JSON::Parse(R"({"a":1,"b":[true,null,"str",-4,1.5],"c":{"d":"e"}})");
+    value2 = JSON::Parse(R"({"c":{"d":"e"},"b":[true,null,"str",-4,1.5],"a":1})");
+
+    // Member order does not matter.
+    test.IsTrue(value1.Equals(value2), __LINE__);
+    test.IsEqual(value1.Hash(), value2.Hash(), __LINE__);
+
+    // Item order does.
+    value2 = JSON::Parse(R"({"a":1,"b":[null,true,"str",-4,1.5],"c":{"d":"e"}})");
+    test.IsFalse(value1.Equals(value2), __LINE__);
+    test.IsNotEqual(value1.Hash(), value2.Hash(), __LINE__);
+
+    // No conversion between numbers.
+    value2 = JSON::Parse(R"({"a":1.0,"b":[true,null,"str",-4,1.5],"c":{"d":"e"}})");
+    test.IsFalse(value1.Equals(value2), __LINE__);
+    test.IsNotEqual(value1.Hash(), value2.Hash(), __LINE__);
+
+    // Removed items are skipped.
+    value2 = JSON::Parse(R"({"a":1,"b":[true,null,"str",-4,1.5],"c":{"d":"e"},"f":0})");
+    test.IsFalse(value1.Equals(value2), __LINE__);
+    value2.Remove("f", 1);
+    test.IsTrue(value1.Equals(value2), __LINE__);
+    test.IsEqual(value1.Hash(), value2.Hash(), __LINE__);
+
+    value1 = 0.0;
+    value2 = -0.0;
+    test.IsTrue(value1.Equals(value2), __LINE__);
+    test.IsEqual(value1.Hash(), value2.Hash(), __LINE__);
+
+    value1 = "abc";
+    value2 = "abd";
+    test.IsFalse(value1.Equals(value2), __LINE__);
+    test.IsNotEqual(value1.Hash(), value2.Hash(), __LINE__);
+
+    value1 = ValueC{ValueType::Array};
+    value2 = ValueC{ValueType::Object};
+    test.IsFalse(value1.Equals(value2), __LINE__);
+    test.IsNotEqual(value1.Hash(), value2.Hash(), __LINE__);
+
+    // Shared values hash their content, once.
+    value1 = JSON::Parse(R"({"list":[1,2,3],"name":"x"})");
+    value2 = JSON::Parse(R"({"list":[1,2,3],"name":"x"})");
+    const SizeT64 hash = value1.Hash();
+
+    value1.Share();
+    value2.Share();
+    copy = value1;
+    test.IsEqual(value1.Hash(), hash, __LINE__);
+    test.IsEqual(copy.Hash(), hash, __LINE__);
+    test.IsTrue(copy.Equals(value1), __LINE__);
+    test.IsTrue(value2.Equals(value1), __LINE__);
+
+    // A copy that still holds the block is unchanged; reads do not detach it.
+    test.IsNotNull(static_cast<const ValueC &>(copy).GetValue("list", 4), __LINE__);
+    test.IsTrue(copy.IsShared(), __LINE__);
+    test.IsTrue(copy.Equals(value1), __LINE__);
+
+    // A change detaches the copy; the shared one keeps its hash.
+    copy["name"] = "y";
+    test.IsFalse(copy.IsShared(), __LINE__);
+    test.IsNotEqual(copy.Hash(), hash, __LINE__);
+    test.IsFalse(copy.Equals(value1), __LINE__);
+    test.IsEqual(value1.Hash(), hash, __LINE__);
+
+    // Shared subtrees inside a tree.
+    copy.Reset();
+    copy["x"] = value1;
+    ValueC plain;
+    plain["x"] = JSON::Parse(R"({"name":"x","list":[1,2,3]})");
+    test.IsEqual(copy.Hash(), plain.Hash(), __LINE__);
+    test.IsTrue(copy.Equals(plain), __LINE__);
+    test.IsTrue(plain.Equals(copy), __LINE__);
+}
+
+static Value<char> BuildRows(KeyTable<char> &table, const StringView<char> *keys) {
+    ValueBuilder<char> builder{table, keys, 3};
+    Value<char>       &row = builder.AddRow();
+
+    row[0] = 7;
+    row[1] = "seven";
+
+    return builder.Take();
+}
+
+static void TestValueBuilder(QTest &test) {
+    using ValueC = Value<char>;
+
+    StringStream<char>     ss;
+    const StringView<char> keys[] = {{"id", 2}, {"a_name_longer_than_inline", 25}, {"flag", 4}};
+    KeyTable<char>         table;
+    ValueBuilder<char>     builder{table, keys, 3};
+
+    test.IsEqual(builder.Columns(), SizeT{3}, __LINE__);
+    builder.Expect(3);
+
+    ValueC &row1 = builder.AddRow();
+    row1[0]      = 1;
+    row1[1]      = "one";
+    row1[2]      = true;
+
+    ValueC &row2 = builder.AddRow();
+    row2[0]      = 2;
+    row2[2]      = false; // Without a value, the second key is skipped.
+
+    ValueC &row3                      = builder.AddRow();
+    row3["a_name_longer_than_inline"] = "three"; // By key as well.
+    test.IsEqual(builder.Rows(), SizeT{3}, __LINE__);
+
+    // Longer keys borrow the table's one copy, shorter ones are inline.
+    const ValueC *row = &row1;
+    test.IsTrue(row->GetObject()->First()[1].Key.IsBorrowed(), __LINE__);
+    test.IsTrue(row->GetObject()->First()[0].Key.IsInline(), __LINE__);
+    test.IsEqual(row->GetObject()->First()[1].Key.First(), row3.GetObject()->First()[1].Key.First(), __LINE__);
+    test.IsEqual(table.Size(), SizeT{1}, __LINE__);
+    test.IsTrue(row->GetObject()->Capacity() == SizeT{4}, __LINE__);
+
+    const char *interned = row->GetObject()->First()[1].Key.First();
+    test.IsNotNull(row->GetValue("flag", 4), __LINE__);
+
+    ValueC rows = builder.Take();
+    test.IsEqual(builder.Rows(), SizeT{0}, __LINE__);
+    test.IsTrue(rows.GetArray()->Capacity() == SizeT{3}, __LINE__);
+    test.IsEqual(rows.Stringify(ss),
+                 R"([{"id":1,"a_name_longer_than_inline":"one","flag":true},)"
+                 R"({"id":2,"flag":false},{"a_name_longer_than_inline":"three"}])",
+                 __LINE__);
+    ss.Clear();
+
+    // A copy holds its own keys.
+    ValueC copy = rows;
+    test.IsFalse(copy.GetValueAt(0)->GetObject()->First()[1].Key.IsBorrowed(), __LINE__);
+    test.IsTrue(copy.Equals(rows), __LINE__);
+
+    // The same keys serve the next batch.
+    builder.AddRow()[0] = 4;
+    rows                = builder.Take();
+    test.IsEqual(rows.Stringify(ss), R"([{"id":4}])", __LINE__);
+    ss.Clear();
+
+    ValueBuilder<char> empty{table, nullptr, 0};
+    empty.AddRow();
+    rows = empty.Take();
+    test.IsEqual(rows.Stringify(ss), R"([{}])", __LINE__);
+    ss.Clear();
+
+    // Rows outlive the builder that made them, even once its memory is reused; the keys live
+    // in the table, which another builder shares.
+    rows = BuildRows(table, keys);
+
+    ValueC filler;
+
+    for (SizeT i = 0; i < 64; i++) {
+        filler += StringView<char>{"xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx", (SizeT{20} + (i % SizeT{20}))};
+    }
+
+    row = rows.GetValueAt(0);
+    test.IsTrue(row->GetObject()->First()[1].Key.IsBorrowed(), __LINE__);
+    test.IsEqual(row->GetObject()->First()[1].Key.First(), interned, __LINE__);
+    test.IsEqual(table.Size(), SizeT{1}, __LINE__);
+    test.IsEqual(rows.Stringify(ss), R"([{"id":7,"a_name_longer_than_inline":"seven"}])", __LINE__);
+    ss.Clear();
+}
+
 static void TestIndexOperator1(QTest &test) {
     using ValueC  = Value<char>;
     using StringT = typename ValueC::StringT;
@@ -5476,6 +5825,627 @@ static void TestStringify5(QTest &test) {
     test.IsEqual(value.Stringify(ss), R"(["\"\\\/\b\f\n\r\t"])", __LINE__);
 }
 
+static void TestStringify6(QTest &test) {
+    using ValueC = Value<char>;
+
+    StringStream<char> ss;
+    ValueC             value;
+
+    value["a"]      = 1;
+    value["b"][0]   = -25;
+    value["b"][1]   = "x\ny";
+    value["c"]      = ValueC{ValueType::Object};
+    value["d"]      = ValueC{ValueType::Array};
+    value["e"]["f"] = nullptr;
+
+    test.IsEqual(value.Stringify(ss), R"({"a":1,"b":[-25,"x\ny"],"c":{},"d":[],"e":{"f":null}})", __LINE__);
+    test.IsTrue((ss.Capacity() >= ss.Length()), __LINE__);
+    ss.Clear();
+
+    test.IsEqual(value.Stringify(ss, QentemConfig::DoublePrecision, 2U), R"({
+  "a": 1,
+  "b": [
+    -25,
+    "x\ny"
+  ],
+  "c": {},
+  "d": [],
+  "e": {
+    "f": null
+  }
+})",
+                 __LINE__);
+    ss.Clear();
+
+    test.IsEqual(value.Stringify(ss, QentemConfig::DoublePrecision, 1U), value.Stringify(QentemConfig::DoublePrecision, 1U), __LINE__);
+    ss.Clear();
+
+    // Measured before writing: one reservation, no growth while writing.
+    ValueC list;
+    list[0] = "\"\"\"\"\"\"\"\"\"\"\"\"\"\"\"\"\"\"\"\"\"\"\"\"\"\"\"\"\"\"\"\"\"\"\"\"\"\"\"\"";
+    list[1] = 18446744073709551615ULL;
+    list[2] = -9223372036854775807LL;
+    list[3] = true;
+    list[4] = false;
+
+    StringStream<char> exact;
+    list.Stringify(exact, QentemConfig::DoublePrecision, 4U);
+    test.IsEqual(exact.Capacity(), Reserver::RoundUpBytes<char>(exact.Length()), __LINE__);
+
+    exact.Reset();
+    list.Stringify(exact);
+    test.IsEqual(exact.Capacity(), Reserver::RoundUpBytes<char>(exact.Length()), __LINE__);
+}
+
+static void TestMessagePack(QTest &test) {
+    using ValueC = Value<char>;
+
+    StringStream<char> ss;
+    StringStream<char> packed;
+    ValueC             value;
+    ValueC             value2;
+
+    // Known encodings.
+    value[0] = SizeT64{1};
+    value[1] = -1;
+    value[2] = "ab";
+    value[3] = true;
+    value[4] = nullptr;
+    MessagePack::Encode(value, packed);
+    test.IsEqual(packed, "\x95\x01\xFF\xA2"
+                         "ab\xC3\xC0",
+                 __LINE__);
+    packed.Clear();
+
+    value.Reset();
+    value["a"] = SizeT64{300};
+    value["b"] = SizeT64I{100};
+    value["c"] = 1.5;
+    MessagePack::Encode(value, packed);
+    test.IsEqual(packed.Length(), SizeT{21}, __LINE__);
+    test.IsEqual(packed.First()[0], char(0x83), __LINE__);
+    test.IsEqual(packed.First()[3], char(0xCD), __LINE__);  // uint16
+    test.IsEqual(packed.First()[8], char(0xD0), __LINE__);  // int8: a positive IntLong stays signed
+    test.IsEqual(packed.First()[12], char(0xCB), __LINE__); // float64
+
+    value2 = MessagePack::Decode(packed.First(), packed.Length());
+    test.IsTrue(value2["a"].IsUInt64(), __LINE__);
+    test.IsTrue(value2["b"].IsInt64(), __LINE__);
+    test.IsTrue(value2["c"].IsDouble(), __LINE__);
+    test.IsEqual(value2.Stringify(ss), R"({"a":300,"b":100,"c":1.5})", __LINE__);
+    ss.Clear();
+    packed.Clear();
+
+    // Round trip across every size class.
+    value.Reset();
+    value["u"][0]  = SizeT64{127};
+    value["u"][1]  = SizeT64{128};
+    value["u"][2]  = SizeT64{65535};
+    value["u"][3]  = SizeT64{65536};
+    value["u"][4]  = SizeT64{4294967296ULL};
+    value["u"][5]  = SizeT64{18446744073709551615ULL};
+    value["i"][0]  = SizeT64I{-32};
+    value["i"][1]  = SizeT64I{-33};
+    value["i"][2]  = SizeT64I{-129};
+    value["i"][3]  = SizeT64I{-32769};
+    value["i"][4]  = SizeT64I{-2147483649LL};
+    value["i"][5]  = SizeT64I{-9223372036854775807LL};
+    value["d"]     = -0.1;
+    value["f"]     = false;
+    value["e"]     = ValueC{ValueType::Object};
+    value["s31"]   = "0123456789012345678901234567890";
+    value["s32"]   = "01234567890123456789012345678901";
+    value["empty"] = "";
+    value["x"]     = 5;
+    value.RemoveAt(SizeT{8}); // "x": undefined items are skipped.
+
+    StringStream<char> big;
+    SizeT              count = 0;
+
+    while (count < 300U) {
+        big += "0123456789";
+        value["list"] += count;
+        ++count;
+    }
+
+    value["big"] = big.GetString();
+
+    MessagePack::Encode(value, packed);
+    test.IsEqual(packed.Capacity(), Reserver::RoundUpBytes<char>(packed.Length()), __LINE__);
+
+    value2 = MessagePack::Decode(packed.First(), packed.Length());
+    test.IsTrue(value2.IsObject(), __LINE__);
+    test.IsEqual(value2.Size(), SizeT{10}, __LINE__);
+    test.IsTrue(value2["i"][1].IsInt64(), __LINE__);
+    test.IsEqual(value2.Stringify(ss), value.Stringify(), __LINE__);
+    ss.Clear();
+
+    // Malformed input.
+    test.IsTrue(MessagePack::Decode(packed.First(), (packed.Length() - 1U)).IsUndefined(), __LINE__);
+    test.IsTrue(MessagePack::Decode("\xC0\xC0", 2U).IsUndefined(), __LINE__);
+    test.IsTrue(MessagePack::Decode("\xC4\x00", 2U).IsUndefined(), __LINE__); // bin 8
+    test.IsTrue(MessagePack::Decode("\x81\x01\x01", 3U).IsUndefined(), __LINE__); // non-string key
+    test.IsTrue(MessagePack::Decode("\xDD\xFF\xFF\xFF\xFF\xC0", 6U).IsUndefined(), __LINE__);
+    test.IsTrue(MessagePack::Decode("", 0U).IsUndefined(), __LINE__);
+    test.IsTrue(MessagePack::Decode("\xC0", 1U).IsNull(), __LINE__);
+
+    // Wide strings keep their code units.
+    Value<char16_t> wide;
+    wide[u"key"] = u"باب";
+    packed.Clear();
+    MessagePack::Encode(wide, packed);
+
+    const Value<char16_t> wide2 = MessagePack::Decode<char16_t>(packed.First(), packed.Length());
+    test.IsTrue(wide2.GetValue(u"key", 3U) != nullptr, __LINE__);
+    test.IsTrue(wide2.GetValue(u"key", 3U)->GetStringView() == StringView<char16_t>{u"باب", 3U},
+                __LINE__);
+}
+
+static void TestCompactValue(QTest &test) {
+    using ValueC = Value<char>;
+    using NodeC  = CompactValue<char>;
+
+    StringStream<char> ss;
+    ValueC             value;
+    const NodeC       *node;
+    StringView<char>   key;
+    QNumber64          number;
+
+    test.IsEqual(sizeof(NodeC), SizeT{16}, __LINE__);
+
+    CompactTree<char> tree;
+    test.IsTrue(tree.Root().IsUndefined(), __LINE__);
+    test.IsEqual(tree.Bytes(), SystemLong{16}, __LINE__);
+
+    tree = CompactTree<char>{ValueC{"short"}};
+    test.IsTrue(tree.Root().IsString(), __LINE__);
+    test.IsEqual(tree.Root().GetStringView(), "short", __LINE__);
+    test.IsEqual(tree.Bytes(), SystemLong{16}, __LINE__); // Inline.
+
+    value["id"]          = SizeT64{7};
+    value["name"]        = "A name longer than a node";
+    value["rate"]        = -2.5;
+    value["tags"][0]     = "a";
+    value["tags"][1]     = SizeT64I{-3};
+    value["tags"][2]     = nullptr;
+    value["flags"]["on"] = true;
+    value["flags"]["no"] = false;
+    value["gone"]        = 1;
+    value.Remove("gone"); // Undefined members are skipped.
+    value["empty"] = ValueC{ValueType::Array};
+
+    tree = CompactTree<char>{value};
+
+    const NodeC &root = tree.Root();
+    test.IsTrue(root.IsObject(), __LINE__);
+    test.IsEqual(root.Size(), SizeT{6}, __LINE__);
+    // 6 pairs, 3 tags, 2 flag pairs, and 26 characters of text in two more nodes.
+    test.IsEqual(tree.Bytes(), SystemLong((1 + 12 + 3 + 4 + 2) * 16), __LINE__);
+
+    node = root.GetValue("id", 2);
+    test.IsNotNull(node, __LINE__);
+    test.IsTrue(node->IsUInt64(), __LINE__);
+    test.IsTrue((node->SetNumber(number) == QNumberType::Natural), __LINE__);
+    test.IsEqual(number.Natural, SizeT64{7}, __LINE__);
+
+    node = root.GetValue(StringView<char>{"name"});
+    test.IsNotNull(node, __LINE__);
+    test.IsEqual(node->GetStringView(), "A name longer than a node", __LINE__);
+    test.IsEqual(node->StringStorage()[node->Length()], char{0}, __LINE__);
+
+    test.IsNull(root.GetValue("gone", 4), __LINE__);
+    test.IsNull(root.GetValue("nam", 3), __LINE__);
+
+    node = root.GetValue("tags", 4);
+    test.IsTrue(node->IsArray(), __LINE__);
+    test.IsEqual(node->Size(), SizeT{3}, __LINE__);
+    test.IsEqual(node->GetValueAt(0)->GetStringView(), "a", __LINE__);
+    test.IsTrue(node->GetValueAt(1)->IsInt64(), __LINE__);
+    test.IsTrue(node->GetValue("2", 1)->IsNull(), __LINE__);
+    test.IsNull(node->GetValueAt(3), __LINE__);
+
+    root.SetValueAndKeyAt(4, node, key);
+    test.IsEqual(key, "flags", __LINE__);
+    test.IsTrue(node->GetValue("on", 2)->IsTrue(), __LINE__);
+    test.IsEqual(root.GetKeyAt(2)->GetStringView(), "rate", __LINE__);
+    test.IsNull(root.GetKeyAt(6), __LINE__);
+
+    node = root.GetValueAt(2);
+    test.IsTrue(node->CopyValueTo(ss), __LINE__);
+    test.IsEqual(ss, "-2.5", __LINE__);
+    ss.Clear();
+    test.IsFalse(root.CopyValueTo(ss), __LINE__);
+
+    test.IsEqual(tree.ToValue().Stringify(ss),
+                 R"({"id":7,"name":"A name longer than a node","rate":-2.5,"tags":["a",-3,null],)"
+                 R"("flags":{"on":true,"no":false},"empty":[]})",
+                 __LINE__);
+    ss.Clear();
+
+    // Pointers are followed when copying.
+    ValueC ptr_value;
+    ptr_value.SetPointerToValue(&value);
+    CompactTree<char> tree2{ptr_value};
+    test.IsTrue(tree2.Root().IsObject(), __LINE__);
+    test.IsEqual(tree2.Root().Size(), SizeT{6}, __LINE__);
+
+    CompactTree<char> tree3{QUtility::Move(tree2)};
+    test.IsTrue(tree2.Root().IsUndefined(), __LINE__);
+    test.IsEqual(tree3.Root().GetValue("name", 4)->GetStringView(), "A name longer than a node", __LINE__);
+
+    CompactTree<char16_t> tree4{Value<char16_t>{u"wide text here"}};
+    test.IsTrue(tree4.Root().IsString(), __LINE__);
+    test.IsEqual(tree4.Root().Length(), SizeT{14}, __LINE__);
+    test.IsTrue(StringUtils::IsEqual(tree4.Root().StringStorage(), u"wide text here", 15U), __LINE__);
+
+    // From HashedMinimum members on, objects are looked up through a hash table.
+    const char *keys[] = {"k0", "k1", "k2", "k3", "k4", "k5", "k6", "k7", "k8", "k9"};
+    value.Reset();
+
+    for (SizeT i = 0; i < SizeT{10}; i++) {
+        value[keys[i]] = i;
+    }
+
+    tree = value.Freeze();
+    // 10 pairs and a table of 32 slots, 8 bytes each.
+    test.IsEqual(tree.Bytes(), SystemLong((1 + 20 + 16) * 16), __LINE__);
+
+    for (SizeT i = 0; i < SizeT{10}; i++) {
+        node = tree.Root().GetValue(keys[i], 2);
+        test.IsNotNull(node, __LINE__);
+        test.IsEqual(node->GetDouble(), double(i), __LINE__);
+
+        node = tree.Root().GetValue(keys[i], 2, StringUtils::Hash(keys[i], SizeT{2}));
+        test.IsNotNull(node, __LINE__);
+        test.IsEqual(node->GetDouble(), double(i), __LINE__);
+    }
+
+    test.IsNull(tree.Root().GetValue("k10", 3), __LINE__);
+    test.IsNull(tree.Root().GetValue("k", 1), __LINE__);
+    test.IsEqual(tree.Root().GetKeyAt(9)->GetStringView(), "k9", __LINE__);
+    test.IsEqual(tree.ToValue().Stringify(ss),
+                 R"({"k0":0,"k1":1,"k2":2,"k3":3,"k4":4,"k5":5,"k6":6,"k7":7,"k8":8,"k9":9})", __LINE__);
+    ss.Clear();
+
+    // Nested large objects.
+    ValueC outer;
+    outer["a"]     = value;
+    outer["b"][0]  = value;
+    tree           = outer.Freeze();
+    node           = tree.Root().GetValue("b", 1)->GetValueAt(0)->GetValue("k7", 2);
+    test.IsNotNull(node, __LINE__);
+    test.IsEqual(node->GetDouble(), 7.0, __LINE__);
+    test.IsEqual(tree.Root().GetValue("a", 1)->GetValue("k3", 2)->GetDouble(), 3.0, __LINE__);
+}
+
+static void TestJSONPatch(QTest &test) {
+    using ValueC = Value<char>;
+
+    StringStream<char> ss;
+    ValueC             from;
+    ValueC             to;
+    ValueC             patch;
+
+    from = JSON::Parse(R"({"id":1,"name":"a","tags":["x","y"],"meta":{"a/b":1,"c~d":2},"gone":true})");
+    to   = JSON::Parse(R"({"id":2,"name":"a","tags":["x","z","w"],"meta":{"a/b":1,"c~d":3},"new":null})");
+
+    patch = JSONPatch::Diff(from, to);
+    test.IsEqual(patch.Stringify(ss),
+                 R"([{"op":"replace","path":"\/id","value":2},)"
+                 R"({"op":"replace","path":"\/tags\/1","value":"z"},)"
+                 R"({"op":"add","path":"\/tags\/2","value":"w"},)"
+                 R"({"op":"replace","path":"\/meta\/c~0d","value":3},)"
+                 R"({"op":"remove","path":"\/gone"},)"
+                 R"({"op":"add","path":"\/new","value":null}])",
+                 __LINE__);
+    ss.Clear();
+
+    test.IsTrue(JSONPatch::Apply(from, patch), __LINE__);
+    test.IsEqual(from.Stringify(ss), to.Stringify(), __LINE__);
+    ss.Clear();
+
+    // Nothing changed.
+    patch = JSONPatch::Diff(from, to);
+    test.IsEqual(patch.Stringify(ss), R"([])", __LINE__);
+    ss.Clear();
+
+    // Keys in another order, shorter arrays, and a different type.
+    from = JSON::Parse(R"({"b":[1,2,3,4],"a":{"x":1},"c":"s"})");
+    to   = JSON::Parse(R"({"a":{"x":1},"b":[1],"c":{"s":1}})");
+
+    patch = JSONPatch::Diff(from, to);
+    test.IsEqual(patch.Stringify(ss),
+                 R"([{"op":"remove","path":"\/b\/3"},{"op":"remove","path":"\/b\/2"},{"op":"remove","path":"\/b\/1"},)"
+                 R"({"op":"replace","path":"\/c","value":{"s":1}}])",
+                 __LINE__);
+    ss.Clear();
+
+    test.IsTrue(JSONPatch::Apply(from, patch), __LINE__);
+    test.IsEqual(from.Stringify(ss), R"({"b":[1],"a":{"x":1},"c":{"s":1}})", __LINE__);
+    ss.Clear();
+
+    // A shared subtree is not visited.
+    from = JSON::Parse(R"({"big":[1,2,3],"n":1})");
+    from["big"].Share();
+    to      = from;
+    to["n"] = 2;
+    test.IsTrue(to.GetValue("big", 3)->IsShared(), __LINE__);
+    patch = JSONPatch::Diff(from, to);
+    test.IsEqual(patch.Stringify(ss), R"([{"op":"replace","path":"\/n","value":2}])", __LINE__);
+    ss.Clear();
+
+    // The root itself.
+    patch = JSONPatch::Diff(ValueC{1}, ValueC{"one"});
+    test.IsEqual(patch.Stringify(ss), R"([{"op":"replace","path":"","value":"one"}])", __LINE__);
+    ss.Clear();
+
+    // All operations.
+    to    = JSON::Parse(R"({"foo":["bar","baz"],"obj":{"k":1}})");
+    patch = JSON::Parse(R"([)"
+                        R"({"op":"add","path":"/foo/1","value":"qux"},)"
+                        R"({"op":"add","path":"/foo/-","value":"end"},)"
+                        R"({"op":"remove","path":"/foo/0"},)"
+                        R"({"op":"copy","from":"/obj","path":"/copied"},)"
+                        R"({"op":"move","from":"/obj/k","path":"/moved"},)"
+                        R"({"op":"replace","path":"/copied/k","value":[1]},)"
+                        R"({"op":"move","from":"/moved","path":"/moved"},)"
+                        R"({"op":"test","path":"/foo","value":["qux","baz","end"]},)"
+                        R"({"op":"test","path":"/copied","value":{"k":[1]}}])");
+    test.IsTrue(JSONPatch::Apply(to, patch), __LINE__);
+    test.IsEqual(to.Stringify(ss), R"({"foo":["qux","baz","end"],"obj":{},"copied":{"k":[1]},"moved":1})",
+                 __LINE__);
+    ss.Clear();
+
+    // Failures.
+    test.IsFalse(JSONPatch::Apply(to, JSON::Parse(R"([{"op":"test","path":"/moved","value":2}])")), __LINE__);
+    test.IsFalse(JSONPatch::Apply(to, JSON::Parse(R"([{"op":"remove","path":"/nothing"}])")), __LINE__);
+    test.IsFalse(JSONPatch::Apply(to, JSON::Parse(R"([{"op":"add","path":"/foo/9","value":1}])")), __LINE__);
+    test.IsFalse(JSONPatch::Apply(to, JSON::Parse(R"([{"op":"add","path":"/foo/01","value":1}])")), __LINE__);
+    test.IsFalse(JSONPatch::Apply(to, JSON::Parse(R"([{"op":"move","from":"/copied","path":"/copied/k"}])")),
+                 __LINE__);
+    test.IsFalse(JSONPatch::Apply(to, JSON::Parse(R"([{"op":"jump","path":"/foo"}])")), __LINE__);
+    test.IsFalse(JSONPatch::Apply(to, JSON::Parse(R"([{"path":"/foo"}])")), __LINE__);
+    test.IsFalse(JSONPatch::Apply(to, JSON::Parse(R"({"op":"remove","path":"/foo"})")), __LINE__);
+    test.IsEqual(to.Stringify(ss), R"({"foo":["qux","baz","end"],"obj":{},"copied":{"k":[1]},"moved":1})",
+                 __LINE__);
+    ss.Clear();
+
+    // Only "~0" and "~1" are escapes; any other "~" makes the pointer invalid.
+    from = JSON::Parse(R"({"a~":1,"b":2,"~":{"c":3}})");
+    test.IsFalse(JSONPatch::Apply(from, JSON::Parse(R"([{"op":"remove","path":"/a~2"}])")), __LINE__);
+    test.IsFalse(JSONPatch::Apply(from, JSON::Parse(R"([{"op":"replace","path":"/a~","value":0}])")), __LINE__);
+    test.IsFalse(JSONPatch::Apply(from, JSON::Parse(R"([{"op":"remove","path":"/~"}])")), __LINE__);
+    test.IsFalse(JSONPatch::Apply(from, JSON::Parse(R"([{"op":"add","path":"/~/d","value":4}])")), __LINE__);
+    test.IsFalse(JSONPatch::Apply(from, JSON::Parse(R"([{"op":"test","path":"/a~","value":1}])")), __LINE__);
+    test.IsEqual(from.Stringify(ss), R"({"a~":1,"b":2,"~":{"c":3}})", __LINE__);
+    ss.Clear();
+
+    test.IsTrue(JSONPatch::Apply(from, JSON::Parse(R"([{"op":"test","path":"/a~0","value":1},)"
+                                                   R"({"op":"remove","path":"/~0/c"}])")),
+                __LINE__);
+    test.IsEqual(from.Stringify(ss), R"({"a~":1,"b":2,"~":{}})", __LINE__);
+    ss.Clear();
+
+    // Numbers compare by value, whatever type holds them.
+    from = JSON::Parse(R"({"a":1,"b":[2,-3],"c":{"d":4}})");
+    to   = JSON::Parse(R"({"a":1.0,"b":[2.0,-3.0],"c":{"d":4.0}})");
+    test.IsFalse(from.Equals(to), __LINE__);
+    test.IsTrue(from.EqualsNumerically(to), __LINE__);
+    patch = JSONPatch::Diff(from, to);
+    test.IsEqual(patch.Stringify(ss), R"([])", __LINE__);
+    ss.Clear();
+
+    to["a"] = SizeT64I{1};
+    test.IsTrue(from.EqualsNumerically(to), __LINE__);
+    to["a"] = SizeT64I{-1};
+    test.IsFalse(from.EqualsNumerically(to), __LINE__);
+    to["a"] = 1.5;
+    test.IsFalse(from.EqualsNumerically(to), __LINE__);
+
+    test.IsTrue(JSONPatch::Apply(from, JSON::Parse(R"([{"op":"test","path":"/c","value":{"d":4.0}}])")), __LINE__);
+    test.IsTrue(JSONPatch::Apply(from, JSON::Parse(R"([{"op":"test","path":"/b/1","value":-3.0}])")), __LINE__);
+    test.IsFalse(JSONPatch::Apply(from, JSON::Parse(R"([{"op":"test","path":"/a","value":1.5}])")), __LINE__);
+    test.IsFalse(JSONPatch::Apply(from, JSON::Parse(R"([{"op":"test","path":"/a","value":"1"}])")), __LINE__);
+
+    // No conversion rounds: 2^53 + 1 is not the double 2^53, and 2^64 is past every integer.
+    test.IsFalse(ValueC{SizeT64{9007199254740993ULL}}.EqualsNumerically(ValueC{9007199254740992.0}), __LINE__);
+    test.IsTrue(ValueC{SizeT64{9007199254740992ULL}}.EqualsNumerically(ValueC{9007199254740992.0}), __LINE__);
+    test.IsTrue(ValueC{SizeT64I{-9007199254740992LL}}.EqualsNumerically(ValueC{-9007199254740992.0}), __LINE__);
+    test.IsFalse(ValueC{~SizeT64{0}}.EqualsNumerically(ValueC{18446744073709551616.0}), __LINE__);
+    test.IsTrue(ValueC{SizeT64{1} << 63U}.EqualsNumerically(ValueC{9223372036854775808.0}), __LINE__);
+    test.IsFalse(ValueC{SizeT64I{-1}}.EqualsNumerically(ValueC{~SizeT64{0}}), __LINE__);
+
+    // Equal shared subtrees in different blocks are skipped once their hashes match and
+    // EqualsNumerically() confirms it.
+    from = JSON::Parse(R"({"a":{"big":[1,2,3]},"b":1})");
+    to   = JSON::Parse(R"({"a":{"big":[1,2,3]},"b":2})");
+    from["a"].Share();
+    to["a"].Share();
+    patch = JSONPatch::Diff(from, to);
+    test.IsEqual(patch.Stringify(ss), R"([{"op":"replace","path":"\/b","value":2}])", __LINE__);
+    ss.Clear();
+
+    // Different hashes lead into the subtrees: a change inside them, or numbers equal by value.
+    from = JSON::Parse(R"({"a":{"big":[1,2,3]}})");
+    to   = JSON::Parse(R"({"a":{"big":[1,2,4]}})");
+    from["a"].Share();
+    to["a"].Share();
+    patch = JSONPatch::Diff(from, to);
+    test.IsEqual(patch.Stringify(ss), R"([{"op":"replace","path":"\/a\/big\/2","value":4}])", __LINE__);
+    ss.Clear();
+
+    from = JSON::Parse(R"({"a":[1,2.5]})");
+    to   = JSON::Parse(R"({"a":[1.0,2.5]})");
+    from["a"].Share();
+    to["a"].Share();
+    test.IsFalse(from["a"].Hash() == to["a"].Hash(), __LINE__);
+    patch = JSONPatch::Diff(from, to);
+    test.IsEqual(patch.Stringify(ss), R"([])", __LINE__);
+    ss.Clear();
+
+    // A value that points to another one is read-only: paths into it fail and leave it as it
+    // is, while the pointer itself can be replaced or removed.
+    ValueC target = JSON::Parse(R"({"x":1,"y":2})");
+    ValueC items  = JSON::Parse(R"([1,2])");
+    ValueC document;
+    document.AddPointerToValue(&items);
+    document.AddPointerToValue(&target);
+
+    test.IsFalse(JSONPatch::Apply(document, JSON::Parse(R"([{"op":"add","path":"/0/-","value":3}])")), __LINE__);
+    test.IsFalse(JSONPatch::Apply(document, JSON::Parse(R"([{"op":"add","path":"/1/z","value":3}])")), __LINE__);
+    test.IsFalse(JSONPatch::Apply(document, JSON::Parse(R"([{"op":"remove","path":"/0/0"}])")), __LINE__);
+    test.IsFalse(JSONPatch::Apply(document, JSON::Parse(R"([{"op":"remove","path":"/1/x"}])")), __LINE__);
+    test.IsFalse(JSONPatch::Apply(document, JSON::Parse(R"([{"op":"replace","path":"/1/x","value":3}])")),
+                 __LINE__);
+    test.IsEqual(document.Stringify(ss), R"([[1,2],{"x":1,"y":2}])", __LINE__);
+    ss.Clear();
+    test.IsEqual(items.Stringify(ss), R"([1,2])", __LINE__);
+    ss.Clear();
+    test.IsEqual(target.Stringify(ss), R"({"x":1,"y":2})", __LINE__);
+    ss.Clear();
+
+    test.IsTrue(JSONPatch::Apply(document, JSON::Parse(R"([{"op":"test","path":"/1","value":{"x":1,"y":2}}])")),
+                __LINE__);
+    test.IsTrue(JSONPatch::Apply(document, JSON::Parse(R"([{"op":"replace","path":"/1","value":{"z":3}},)"
+                                                       R"({"op":"add","path":"/1/w","value":4},)"
+                                                       R"({"op":"remove","path":"/0"}])")),
+                __LINE__);
+    test.IsEqual(document.Stringify(ss), R"([{"z":3,"w":4}])", __LINE__);
+    ss.Clear();
+    test.IsEqual(target.Stringify(ss), R"({"x":1,"y":2})", __LINE__);
+    ss.Clear();
+
+    // The pointer at the root.
+    document.SetPointerToValue(&target);
+    test.IsFalse(JSONPatch::Apply(document, JSON::Parse(R"([{"op":"add","path":"/z","value":3}])")), __LINE__);
+    test.IsFalse(JSONPatch::Apply(document, JSON::Parse(R"([{"op":"remove","path":"/x"}])")), __LINE__);
+    test.IsEqual(target.Stringify(ss), R"({"x":1,"y":2})", __LINE__);
+    ss.Clear();
+}
+
+static void TestColumnTable(QTest &test) {
+    using ValueC = Value<char>;
+    using TableC = ColumnTable<char>;
+
+    StringStream<char> ss;
+    ValueC             records;
+    ValueC             value;
+    const char        *content;
+
+    content = R"([{"id":3,"name":"c","price":1.5,"off":-1,"ok":true,"tag":"x"},)"
+              R"({"id":1,"name":"a","price":0.5,"off":-3,"ok":false,"tag":1},)"
+              R"({"id":2,"name":"b","price":1.5,"off":-2,"ok":true}])";
+    records = JSON::Parse(content);
+
+    TableC table{records};
+    test.IsEqual(table.Rows(), SizeT{3}, __LINE__);
+    test.IsEqual(table.Columns(), SizeT{6}, __LINE__);
+    test.IsTrue(table.GetColumn("id", 2)->Type == ColumnType::Natural, __LINE__);
+    test.IsTrue(table.GetColumn("name", 4)->Type == ColumnType::String, __LINE__);
+    test.IsTrue(table.GetColumn("price", 5)->Type == ColumnType::Real, __LINE__);
+    test.IsTrue(table.GetColumn("off", 3)->Type == ColumnType::Integer, __LINE__);
+    test.IsTrue(table.GetColumn("ok", 2)->Type == ColumnType::Bool, __LINE__);
+    test.IsTrue(table.GetColumn("tag", 3)->Type == ColumnType::Mixed, __LINE__); // Two types, and missing once.
+    test.IsNull(table.GetColumn("none", 4), __LINE__);
+    test.IsEqual(table.GetColumn("price", 5)->Numbers.First()[1].Real, 0.5, __LINE__);
+
+    // Reading back.
+    test.IsTrue(table.ToValue().Equals(records), __LINE__);
+    test.IsEqual(table.GetValueAt(1).Stringify(ss), R"({"id":1,"name":"a","price":0.5,"off":-3,"ok":false,"tag":1})",
+                 __LINE__);
+    ss.Clear();
+    test.IsEqual(table.GetValueAt(2).Stringify(ss), R"({"id":2,"name":"b","price":1.5,"off":-2,"ok":true})",
+                 __LINE__);
+    ss.Clear();
+    test.IsTrue(table.GetValueAt(3).IsUndefined(), __LINE__);
+    test.IsEqual(table.GetValue(0, "name", 4).GetStringView(), "c", __LINE__);
+    test.IsTrue(table.GetValue(2, "tag", 3).IsUndefined(), __LINE__);
+
+    // Grouping, as Value::GroupBy() does.
+    ValueC grouped1;
+    ValueC grouped2;
+    test.IsTrue(table.GroupBy(grouped1, "price", 5), __LINE__);
+    test.IsTrue(records.GroupBy(grouped2, "price", 5), __LINE__);
+    test.IsTrue(grouped1.Equals(grouped2), __LINE__);
+    test.IsTrue(table.GroupBy(grouped1, "name", 4), __LINE__);
+    test.IsEqual(grouped1["b"][0].Stringify(ss), R"({"id":2,"price":1.5,"off":-2,"ok":true})", __LINE__);
+    ss.Clear();
+    test.IsFalse(table.GroupBy(grouped1, "tag", 3), __LINE__);
+    test.IsFalse(table.GroupBy(grouped1, "none", 4), __LINE__);
+
+    // Sorting is stable, and moves whole rows.
+    test.IsTrue(table.SortBy("id", 2), __LINE__);
+    test.IsEqual(table.ToValue().Stringify(ss),
+                 R"([{"id":1,"name":"a","price":0.5,"off":-3,"ok":false,"tag":1},)"
+                 R"({"id":2,"name":"b","price":1.5,"off":-2,"ok":true},)"
+                 R"({"id":3,"name":"c","price":1.5,"off":-1,"ok":true,"tag":"x"}])",
+                 __LINE__);
+    ss.Clear();
+
+    test.IsTrue(table.SortBy("price", 5, false), __LINE__);
+    test.IsEqual(table.GetValue(0, "id", 2).GetUInt64(), SizeT64{2}, __LINE__);
+    test.IsEqual(table.GetValue(1, "id", 2).GetUInt64(), SizeT64{3}, __LINE__);
+    test.IsEqual(table.GetValue(2, "id", 2).GetUInt64(), SizeT64{1}, __LINE__);
+
+    test.IsTrue(table.SortBy("name", 4, false), __LINE__);
+    test.IsEqual(table.GetValue(0, "name", 4).GetStringView(), "c", __LINE__);
+    test.IsTrue(table.SortBy("off", 3), __LINE__);
+    test.IsEqual(table.GetValue(0, "off", 3).GetInt64(), SizeT64I{-3}, __LINE__);
+    test.IsTrue(table.SortBy("ok", 2), __LINE__);
+    test.IsEqual(table.GetValue(0, "id", 2).GetUInt64(), SizeT64{1}, __LINE__);
+    test.IsTrue(table.SortBy("tag", 3), __LINE__);
+    test.IsFalse(table.SortBy("none", 4), __LINE__);
+
+    // Moving.
+    TableC moved{QUtility::Move(table)};
+    test.IsEqual(table.Rows(), SizeT{0}, __LINE__);
+    test.IsEqual(moved.Rows(), SizeT{3}, __LINE__);
+    test.IsEqual(moved.GetValue(0, "name", 4).GetStringView().Length(), SizeT{1}, __LINE__);
+    table = QUtility::Move(moved);
+    test.IsEqual(table.Rows(), SizeT{3}, __LINE__);
+
+    // Anything other than objects leaves it empty; removed items are skipped.
+    value = JSON::Parse(R"([{"a":1},2])");
+    TableC other{value};
+    test.IsEqual(other.Rows(), SizeT{0}, __LINE__);
+    test.IsEqual(other.Columns(), SizeT{0}, __LINE__);
+
+    value = JSON::Parse(R"([{"a":"x"},{"a":"y"},{"a":"z"}])");
+    value.RemoveAt(1);
+    other = TableC{value};
+    test.IsEqual(other.Rows(), SizeT{2}, __LINE__);
+    test.IsEqual(other.ToValue().Stringify(ss), R"([{"a":"x"},{"a":"z"}])", __LINE__);
+    ss.Clear();
+
+    // Larger, already in order: a merge sort does not degrade.
+    ValueC many{ValueType::Array};
+
+    for (SizeT i = 0; i < 5000; i++) {
+        ValueC row;
+        row["n"] = i;
+        row["m"] = (i & 7U);
+        many += QUtility::Move(row);
+    }
+
+    other = TableC{many};
+    test.IsTrue(other.SortBy("n", 1, false), __LINE__);
+    test.IsEqual(other.GetValue(0, "n", 1).GetUInt64(), SizeT64{4999}, __LINE__);
+    test.IsTrue(other.SortBy("m", 1), __LINE__);
+    test.IsEqual(other.GetValue(0, "n", 1).GetUInt64(), SizeT64{4992}, __LINE__); // Stable.
+    test.IsEqual(other.GetValue(4999, "n", 1).GetUInt64(), SizeT64{7}, __LINE__);
+
+    // 0.0 and -0.0 are equal; their rows keep their order.
+    value = JSON::Parse(R"([{"r":1.5,"i":0},{"r":0.0,"i":1},{"r":-0.0,"i":2}])");
+    other = TableC{value};
+    test.IsTrue(other.SortBy("r", 1), __LINE__);
+    test.IsEqual(other.ToValue().Stringify(ss), R"([{"r":0,"i":1},{"r":-0,"i":2},{"r":1.5,"i":0}])", __LINE__);
+    ss.Clear();
+
+    test.IsTrue(other.SortBy("r", 1, false), __LINE__);
+    test.IsEqual(other.ToValue().Stringify(ss), R"([{"r":1.5,"i":0},{"r":0,"i":1},{"r":-0,"i":2}])", __LINE__);
+    ss.Clear();
+}
+
 static void TestDeleteValue(QTest &test) {
     using ValueC  = Value<char>;
     using ArrayT  = typename ValueC::ArrayT;
@@ -5871,6 +6841,215 @@ static void TestSortValue(QTest &test) {
     test.IsEqual(value.Stringify(ss), R"({"2021":0,"2020":0,"2019":0,"2017":0,"2016":0,"2015":0})", __LINE__);
 }
 
+static void TestSortValue2(QTest &test) {
+    using ValueC = Value<char>;
+
+    StringStream<char> ss;
+    ValueC             value;
+
+    value += -3;
+    value += 7;
+    value += -100;
+    value += 0;
+    value += 7;
+    value += 42;
+
+    value.Sort();
+    test.IsEqual(value.Stringify(ss), R"([-100,-3,0,7,7,42])", __LINE__);
+    ss.Clear();
+
+    value.Sort(false);
+    test.IsEqual(value.Stringify(ss), R"([42,7,7,0,-3,-100])", __LINE__);
+    ss.Clear();
+
+    value.Reset();
+    value += 2.5;
+    value += -0.5;
+    value += 1e10;
+    value += -1e10;
+    value += 0.0;
+
+    value.Sort();
+    test.IsEqual(value.Stringify(ss), R"([-10000000000,-0.5,0,2.5,10000000000])", __LINE__);
+    ss.Clear();
+
+    // 0.0 and -0.0 are equal, and keep their order either way.
+    value.Reset();
+    value += 0.0;
+    value += -0.0;
+    value += 1.5;
+
+    value.Sort();
+    test.IsEqual(value.Stringify(ss), R"([0,-0,1.5])", __LINE__);
+    ss.Clear();
+
+    value.Reset();
+    value += -0.0;
+    value += 0.0;
+    value += -1.5;
+
+    value.Sort(false);
+    test.IsEqual(value.Stringify(ss), R"([-0,0,-1.5])", __LINE__);
+    ss.Clear();
+
+    value.Reset();
+    value += 18446744073709551615ULL;
+    value += 1U;
+    value += 9223372036854775808ULL;
+
+    value.Sort();
+    test.IsEqual(value.Stringify(ss), R"([1,9223372036854775808,18446744073709551615])", __LINE__);
+    ss.Clear();
+
+    value.Reset();
+    value += "pear";
+    value += "apple";
+    value += "peach";
+    value += "Zucchini";
+    value += "banana";
+
+    value.Sort();
+    test.IsEqual(value.Stringify(ss), R"(["Zucchini","apple","banana","peach","pear"])", __LINE__);
+    ss.Clear();
+
+    value.Sort(false);
+    test.IsEqual(value.Stringify(ss), R"(["pear","peach","banana","apple","Zucchini"])", __LINE__);
+    ss.Clear();
+
+    // Mixed items sort as operator< orders them; equal ones keep their order.
+    value.Reset();
+    value += "b";
+    value += 2;
+    value += ValueC{ValueType::Object};
+    value += "a";
+    value[4]["x"] = 1;
+    value += 1;
+    value[2]["y"] = 2;
+
+    value.Sort();
+    test.IsEqual(value.Stringify(ss), R"([{"y":2},{"x":1},"a","b",1,2])", __LINE__);
+    ss.Clear();
+
+    // Sorted input, large enough to show a quadratic sort or a deep recursion.
+    constexpr SizeT count = 100000;
+
+    value.Reset();
+
+    for (SizeT i = 0; i < count; i++) {
+        value += i;
+    }
+
+    value.Sort(false);
+
+    const ValueC *first = value.GetValueAt(0);
+    const ValueC *last  = value.GetValueAt(count - 1);
+
+    test.IsNotNull(first, __LINE__);
+    test.IsNotNull(last, __LINE__);
+
+    if ((first != nullptr) && (last != nullptr)) {
+        test.IsEqual(first->GetNumber(), double(count - 1), __LINE__);
+        test.IsEqual(last->GetNumber(), 0.0, __LINE__);
+    }
+
+    value.Sort();
+
+    bool sorted = true;
+
+    for (SizeT i = 0; i < count; i++) {
+        const ValueC *item = value.GetValueAt(i);
+
+        if ((item == nullptr) || (item->GetNumber() != double(i))) {
+            sorted = false;
+            break;
+        }
+    }
+
+    test.IsTrue(sorted, __LINE__);
+
+    // Sorting in parts, as threads would, then merging them.
+    value.Reset();
+    value += 9;
+    value += 4;
+    value += 7;
+    value += 1;
+    value += 8;
+    value += 3;
+    value += 6;
+    value += 2;
+    value += 5;
+    value += 0;
+
+    const SizeT ends[] = {3, 6, 10};
+
+    value.SortRange(0, 3);
+    value.SortRange(3, 6);
+    value.SortRange(6, 10);
+    test.IsEqual(value.Stringify(ss), R"([4,7,9,1,3,8,0,2,5,6])", __LINE__);
+    ss.Clear();
+
+    test.IsTrue(value.MergeSorted(ends, 3), __LINE__);
+    test.IsEqual(value.Stringify(ss), R"([0,1,2,3,4,5,6,7,8,9])", __LINE__);
+    ss.Clear();
+
+    value.SortRange(0, 5, false);
+    value.SortRange(5, 100, false);
+    const SizeT ends2[] = {5, 10};
+    test.IsTrue(value.MergeSorted(ends2, 2, false), __LINE__);
+    test.IsEqual(value.Stringify(ss), R"([9,8,7,6,5,4,3,2,1,0])", __LINE__);
+    ss.Clear();
+
+    const SizeT short_ends[] = {3, 6};
+    test.IsFalse(value.MergeSorted(short_ends, 2), __LINE__);
+
+    const SizeT bad_ends[] = {6, 3, 10};
+    test.IsFalse(value.MergeSorted(bad_ends, 3), __LINE__);
+
+    // A shared value is left for its owner to separate first.
+    ValueC shared{value};
+    shared.Share();
+    shared.SortRange(0, 10);
+    test.IsFalse(shared.MergeSorted(ends, 3), __LINE__);
+
+    ValueC strings;
+    strings += "delta";
+    strings += "alpha";
+    strings += "charlie";
+    strings += "bravo";
+
+    const SizeT string_ends[] = {2, 4};
+
+    strings.SortRange(0, 2);
+    strings.SortRange(2, 4);
+    test.IsTrue(strings.MergeSorted(string_ends, 2), __LINE__);
+    test.IsEqual(strings.Stringify(ss), R"(["alpha","bravo","charlie","delta"])", __LINE__);
+    ss.Clear();
+
+    // Objects sorted by key from sorted input.
+    value.Reset();
+
+    for (SizeT i = 0; i < 1000; i++) {
+        String<char> key("k");
+        Digit::NumberToString(key, (i + 1000));
+        value[key] = i;
+    }
+
+    value.Sort(false);
+
+    const String<char> *first_key = value.GetKeyAt(0);
+    const String<char> *last_key  = value.GetKeyAt(999);
+    const ValueC       *found     = value.GetValue("k1500", 5);
+
+    test.IsNotNull(first_key, __LINE__);
+    test.IsNotNull(found, __LINE__);
+
+    if ((first_key != nullptr) && (last_key != nullptr) && (found != nullptr)) {
+        test.IsTrue(*first_key == "k1999", __LINE__);
+        test.IsTrue(*last_key == "k1000", __LINE__);
+        test.IsEqual(found->GetNumber(), 500.0, __LINE__);
+    }
+}
+
 static void TestGroupValue(QTest &test) {
     using ValueC  = Value<char>;
     using ArrayT  = typename ValueC::ArrayT;
@@ -6275,6 +7454,12 @@ static int RunValueTests() {
     test.Test("Copy Value Test 2", TestCopyValue2);
     test.Test("Copy Value Test 3", TestCopyValue3);
     test.Test("Copy Value Test 4", TestCopyValue4);
+    test.Test("Shared Value Test", TestSharedValue);
+#if defined(__linux__)
+    test.Test("Shared Value Threads Test", TestSharedValueThreads);
+#endif
+    test.Test("Value Hash Test", TestValueHash);
+    test.Test("Value Builder Test", TestValueBuilder);
 
     test.Test("Index Operator Test 1", TestIndexOperator1);
     test.Test("Index Operator Test 2", TestIndexOperator2);
@@ -6291,11 +7476,17 @@ static int RunValueTests() {
     test.Test("Stringify Test 3", TestStringify3);
     test.Test("Stringify Test 4", TestStringify4);
     test.Test("Stringify Test 5", TestStringify5);
+    test.Test("Stringify Test 6", TestStringify6);
+    test.Test("MessagePack Test", TestMessagePack);
+    test.Test("CompactValue Test", TestCompactValue);
+    test.Test("JSONPatch Test", TestJSONPatch);
+    test.Test("ColumnTable Test", TestColumnTable);
 
     test.Test("Delete Value Test", TestDeleteValue);
     test.Test("Compress Value Test", TestCompressValue);
 
     test.Test("Sort Value Test", TestSortValue);
+    test.Test("Sort Value Test 2", TestSortValue2);
     test.Test("Group Value Test", TestGroupValue);
 
     return test.EndTests();